@@ -0,0 +1,86 @@
+#include <cstddef>
+#include <benchmark/benchmark.h>
+#include <cec/arena.hpp>
+#include <cec/deque.hpp>
+#include <cec/list.hpp>
+#include <cec/vector.hpp>
+#include "support.hpp"
+
+// Each operation is measured on containers using arena_allocator, within a
+// scoped_arena created for every iteration ('arena_*'), and on the same
+// containers using std::allocator, so allocating from the heap ('heap_*').
+// The difference between the two is the cost of malloc and free.
+
+namespace {
+
+struct twice {
+    template <typename T>
+    T operator()(const T& value) const {
+        return value + value;
+    }
+};
+
+struct is_even {
+    template <typename T>
+    bool operator()(const T& value) const {
+        return bench::key(value) % 2 == 0;
+    }
+};
+
+// 'Container' using arena_allocator
+template <typename Container>
+struct arena_container;
+
+template <template <typename, typename> class Sequence, typename T,
+          typename Allocator>
+struct arena_container<
+    cec::extended_sequence_container<Sequence<T, Allocator>>> {
+    using type = cec::extended_sequence_container<
+        Sequence<T, cec::arena_allocator<T>>>;
+};
+
+template <typename Container>
+using arena_t = typename arena_container<Container>::type;
+
+void set_items_processed(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+// A chain of operations, each producing a temporary container
+template <typename Container>
+std::size_t map_filter_map(const Container& c) {
+    return c.map(twice{}).filter(is_even{}).map(twice{}).size();
+}
+
+template <typename Container>
+void arena_map_filter_map(benchmark::State& state) {
+    auto heap = bench::make_container<Container>(state.range(0));
+    const arena_t<Container> c(heap.begin(), heap.end());
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        cec::scoped_arena arena;
+        benchmark::DoNotOptimize(map_filter_map(c));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void heap_map_filter_map(benchmark::State& state) {
+    const auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(map_filter_map(c));
+    }
+    set_items_processed(state);
+}
+
+} // end anonymous namespace
+
+#define CEC_BENCHMARK_ARENA(op, Container)                                     \
+    BENCHMARK_TEMPLATE(arena_##op, Container)->Apply(bench::sizes);            \
+    BENCHMARK_TEMPLATE(heap_##op, Container)->Apply(bench::sizes)
+
+CEC_BENCHMARK_ARENA(map_filter_map, cec::vector<int>);
+CEC_BENCHMARK_ARENA(map_filter_map, cec::list<int>);
+CEC_BENCHMARK_ARENA(map_filter_map, cec::deque<int>);
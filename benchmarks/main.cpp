@@ -0,0 +1,30 @@
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <benchmark/benchmark.h>
+#include "support.hpp"
+
+namespace bench {
+std::atomic<std::size_t> allocation_count(0);
+std::atomic<std::size_t> allocated_bytes(0);
+}
+
+// Replace the global allocation functions so that benchmarks can report
+// how many allocations, and how many bytes, each operation needs. The array
+// and nothrow forms are implemented in terms of these by the standard
+// library.
+void* operator new(std::size_t size) {
+    bench::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    bench::allocated_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+BENCHMARK_MAIN();
@@ -0,0 +1,934 @@
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <numeric>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <cec/deque.hpp>
+#include <cec/forward_list.hpp>
+#include <cec/list.hpp>
+#include <cec/string.hpp>
+#include <cec/vector.hpp>
+#include "support.hpp"
+
+// Each operation is measured in two forms: through CEC ('cec_*') and as the
+// loop a caller would write by hand against the underlying STL container
+// ('stl_*'). The hand written loops produce the same container types as
+// CEC, so the difference between the two is the cost of the abstraction.
+
+namespace {
+
+struct twice {
+    template <typename T>
+    T operator()(const T& value) const {
+        return value + value;
+    }
+};
+
+struct is_even {
+    template <typename T>
+    bool operator()(const T& value) const {
+        return bench::key(value) % 2 == 0;
+    }
+};
+
+struct sum_keys {
+    template <typename T>
+    std::size_t operator()(std::size_t total, const T& value) const {
+        return total + bench::key(value);
+    }
+};
+
+// Erase with the member remove_if where there is one (list), otherwise with
+// the erase-remove idiom
+template <typename Container, typename Predicate>
+auto erase_matching(Container& c, Predicate p, int)
+    -> decltype(c.remove_if(p), void()) {
+    c.remove_if(p);
+}
+
+template <typename Container, typename Predicate>
+void erase_matching(Container& c, Predicate p, long) {
+    c.erase(std::remove_if(c.begin(), c.end(), p), c.end());
+}
+
+// Erase with the member remove where there is one (list, forward_list),
+// otherwise with the erase-remove idiom
+template <typename Container, typename T>
+auto erase_value(Container& c, const T& value, int)
+    -> decltype(c.remove(value), void()) {
+    c.remove(value);
+}
+
+template <typename Container, typename T>
+void erase_value(Container& c, const T& value, long) {
+    c.erase(std::remove(c.begin(), c.end(), value), c.end());
+}
+
+// Append [first, last) to 'c' with insert, or for forward_list, with
+// insert_after its last element (found by walking the list)
+template <typename Container, typename Iterator>
+auto append_range(Container& c, Iterator first, Iterator last, int)
+    -> decltype(c.insert_after(c.before_begin(), first, last), void()) {
+    auto tail = c.before_begin();
+    for (auto next = c.begin(); next != c.end(); ++next) {
+        ++tail;
+    }
+    c.insert_after(tail, first, last);
+}
+
+template <typename Container, typename Iterator>
+void append_range(Container& c, Iterator first, Iterator last, long) {
+    c.insert(c.end(), first, last);
+}
+
+// Sort with the member sort where there is one (list, forward_list),
+// otherwise with std::sort
+template <typename Container>
+auto sort_container(Container& c, int) -> decltype(c.sort(), void()) {
+    c.sort();
+}
+
+template <typename Container>
+void sort_container(Container& c, long) {
+    std::sort(c.begin(), c.end());
+}
+
+void set_items_processed(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+template <typename Container>
+void cec_concat(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.concat(c));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_concat(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container concatenated(c);
+        append_range(concatenated, c.begin(), c.end(), 0);
+        benchmark::DoNotOptimize(concatenated);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_contains(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto missing = bench::missing_value<typename Container::value_type>();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.contains(missing));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_contains(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto missing = bench::missing_value<typename Container::value_type>();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(c.begin(), c.end(), missing) !=
+                                 c.end());
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_count(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto value = *c.begin();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.count(value));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_count(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto value = *c.begin();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count(c.begin(), c.end(), value));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_count_if(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.count_if(is_even{}));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_count_if(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count_if(c.begin(), c.end(), is_even{}));
+    }
+    set_items_processed(state);
+}
+
+// Each value appears four times, in a scrambled order
+template <typename Container>
+Container make_duplicated(std::size_t size) {
+    Container c;
+    auto append = bench::make_appender(c);
+    for (std::size_t i = 0; i < size; ++i) {
+        append(bench::make_value<typename Container::value_type>(
+            bench::scramble(i) % (size / 4 + 1)));
+    }
+    return c;
+}
+
+template <typename Container>
+void cec_distinct(benchmark::State& state) {
+    auto c = make_duplicated<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.distinct());
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_distinct(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+    auto c = make_duplicated<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container unique;
+        std::unordered_set<value_type> seen;
+        auto append = bench::make_appender(unique);
+        for (const auto& value : c) {
+            if (seen.insert(value).second) {
+                append(value);
+            }
+        }
+        benchmark::DoNotOptimize(unique);
+    }
+    set_items_processed(state);
+}
+
+// erase_all, erase_if, extend, sort and transform modify the container, so
+// each iteration includes making a copy of it
+template <typename Container>
+void cec_erase_all(benchmark::State& state) {
+    auto c = make_duplicated<Container>(state.range(0));
+    auto value = *c.begin();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        copy.erase_all(value);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_erase_all(benchmark::State& state) {
+    auto c = make_duplicated<Container>(state.range(0));
+    auto value = *c.begin();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        erase_value(copy, value, 0);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_erase_if(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        copy.erase_if(is_even{});
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_erase_if(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        erase_matching(copy, is_even{}, 0);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_extend(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        copy.extend(c);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_extend(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        append_range(copy, c.begin(), c.end(), 0);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_filter(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.filter(is_even{}));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_filter(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container filtered;
+        auto append = bench::make_appender(filtered);
+        for (const auto& value : c) {
+            if (is_even{}(value)) {
+                append(value);
+            }
+        }
+        benchmark::DoNotOptimize(filtered);
+    }
+    set_items_processed(state);
+}
+
+// The outer container holds vectors of 16 elements each
+template <typename Container>
+using nested_t =
+    bench::rebind_t<Container, cec::vector<typename Container::value_type>>;
+
+template <typename Container>
+nested_t<Container> make_nested(std::size_t size) {
+    using inner_type = cec::vector<typename Container::value_type>;
+    nested_t<Container> nested;
+    auto append = bench::make_appender(nested);
+    for (std::size_t i = 0; i < size; i += 16) {
+        append(bench::make_container<inner_type>(16));
+    }
+    return nested;
+}
+
+template <typename Container>
+void cec_flatten(benchmark::State& state) {
+    auto nested = make_nested<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nested.flatten());
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_flatten(benchmark::State& state) {
+    auto nested = make_nested<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        cec::vector<typename Container::value_type> flattened;
+        for (const auto& inner : nested) {
+            flattened.insert(flattened.end(), inner.begin(), inner.end());
+        }
+        benchmark::DoNotOptimize(flattened);
+    }
+    set_items_processed(state);
+}
+
+// Three levels: 'Container' of vectors of 4 vectors of 16 elements
+template <typename Container>
+using deep_nested_t = bench::rebind_t<
+    Container, cec::vector<cec::vector<typename Container::value_type>>>;
+
+template <typename Container>
+deep_nested_t<Container> make_deep_nested(std::size_t size) {
+    using inner_type = cec::vector<typename Container::value_type>;
+    deep_nested_t<Container> nested;
+    auto append = bench::make_appender(nested);
+    for (std::size_t i = 0; i < size; i += 64) {
+        append(cec::vector<inner_type>(
+            4, bench::make_container<inner_type>(16)));
+    }
+    return nested;
+}
+
+template <typename Container>
+void cec_flatten_all(benchmark::State& state) {
+    auto nested = make_deep_nested<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(nested.flatten_all());
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_flatten_all(benchmark::State& state) {
+    auto nested = make_deep_nested<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        cec::vector<typename Container::value_type> flattened;
+        for (const auto& middle : nested) {
+            for (const auto& inner : middle) {
+                flattened.insert(flattened.end(), inner.begin(), inner.end());
+            }
+        }
+        benchmark::DoNotOptimize(flattened);
+    }
+    set_items_processed(state);
+}
+
+// Emitting each element twice, through a sink and by hand
+template <typename Container>
+void cec_flat_map(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.template flat_map<value_type>(
+            [](const value_type& value, cec::sink<Container>& out) {
+                out(value);
+                out(value);
+            }));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_flat_map(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container mapped;
+        auto append = bench::make_appender(mapped);
+        for (const auto& value : c) {
+            append(value);
+            append(value);
+        }
+        benchmark::DoNotOptimize(mapped);
+    }
+    set_items_processed(state);
+}
+
+// The same, building a vector of the two elements for each element
+template <typename Container>
+void cec_flat_map_containers(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.flat_map([](const value_type& value) {
+            return std::vector<value_type>(2, value);
+        }));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_flat_map_containers(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::vector<std::vector<value_type>> nested;
+        for (const auto& value : c) {
+            nested.push_back(std::vector<value_type>(2, value));
+        }
+        Container mapped;
+        auto append = bench::make_appender(mapped);
+        for (const auto& inner : nested) {
+            for (const auto& value : inner) {
+                append(value);
+            }
+        }
+        benchmark::DoNotOptimize(mapped);
+    }
+    set_items_processed(state);
+}
+
+// Routing elements to 16 groups, by key
+struct shard {
+    template <typename T>
+    long operator()(const T& value) const {
+        return bench::key(value) % 16;
+    }
+};
+
+template <typename Container>
+void cec_group_by(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.group_by(shard{}));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_group_by(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::unordered_map<long, Container> groups;
+        std::unordered_map<long, bench::appender<Container>> appenders;
+        for (const auto& value : c) {
+            long key = shard{}(value);
+            auto group = appenders.find(key);
+            if (group == appenders.end()) {
+                group = appenders
+                            .emplace(key, bench::make_appender(groups[key]))
+                            .first;
+            }
+            group->second(value);
+        }
+        benchmark::DoNotOptimize(groups);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_map(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.map(twice{}));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_map(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container mapped;
+        auto append = bench::make_appender(mapped);
+        for (const auto& value : c) {
+            append(twice{}(value));
+        }
+        benchmark::DoNotOptimize(mapped);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_partition(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.partition(is_even{}));
+    }
+    set_items_processed(state);
+}
+
+// Filtering twice, as partition replaces
+template <typename Container>
+void stl_partition(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::pair<Container, Container> partitioned;
+        auto append_first = bench::make_appender(partitioned.first);
+        for (const auto& value : c) {
+            if (is_even{}(value)) {
+                append_first(value);
+            }
+        }
+        auto append_second = bench::make_appender(partitioned.second);
+        for (const auto& value : c) {
+            if (!is_even{}(value)) {
+                append_second(value);
+            }
+        }
+        benchmark::DoNotOptimize(partitioned);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_reduce(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.reduce(sum_keys{}, std::size_t(0)));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_reduce(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            std::accumulate(c.begin(), c.end(), std::size_t(0), sum_keys{}));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_sort(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        copy.sort();
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_sort(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        sort_container(copy, 0);
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_take(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.take(state.range(0) / 2));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_take(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container taken;
+        auto append = bench::make_appender(taken);
+        auto iter = c.begin();
+        for (auto i = state.range(0) / 2; i != 0; --i, ++iter) {
+            append(*iter);
+        }
+        benchmark::DoNotOptimize(taken);
+    }
+    set_items_processed(state);
+}
+
+// Taking the elements before the one in the middle
+template <typename Container>
+void cec_take_while(benchmark::State& state) {
+    using value_type = typename Container::value_type;
+    auto c = bench::make_container<Container>(state.range(0));
+    auto middle = *std::next(c.begin(), state.range(0) / 2);
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.take_while(
+            [&middle](const value_type& value) { return !(value == middle); }));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_take_while(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto middle = *std::next(c.begin(), state.range(0) / 2);
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container taken;
+        auto append = bench::make_appender(taken);
+        for (auto iter = c.begin(); iter != c.end() && !(*iter == middle);
+             ++iter) {
+            append(*iter);
+        }
+        benchmark::DoNotOptimize(taken);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_transform(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        copy.transform(twice{});
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_transform(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        Container copy(c);
+        std::transform(copy.begin(), copy.end(), copy.begin(), twice{});
+        benchmark::DoNotOptimize(copy);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+using pairs_t = bench::rebind_t<
+    Container, std::pair<typename Container::value_type, std::size_t>>;
+
+template <typename Container>
+void cec_unzip(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto pairs = c.zip(bench::make_container<cec::vector<std::size_t>>(
+        state.range(0)));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(pairs.unzip());
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_unzip(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    auto pairs = c.zip(bench::make_container<cec::vector<std::size_t>>(
+        state.range(0)));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        decltype(pairs.unzip()) unzipped;
+        auto append_first = bench::make_appender(unzipped.first);
+        auto append_second = bench::make_appender(unzipped.second);
+        for (const auto& item : pairs) {
+            append_first(item.first);
+            append_second(item.second);
+        }
+        benchmark::DoNotOptimize(unzipped);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_zip(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.zip(c));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_zip(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    using value_type = typename Container::value_type;
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        bench::rebind_t<Container, std::pair<value_type, value_type>> zipped;
+        auto append = bench::make_appender(zipped);
+        for (auto first = c.begin(), second = c.begin(); first != c.end();
+             ++first, ++second) {
+            append(*first, *second);
+        }
+        benchmark::DoNotOptimize(zipped);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void cec_zip_n(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(c.zip_n(c, c));
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_zip_n(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    using value_type = typename Container::value_type;
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        bench::rebind_t<Container,
+                        std::tuple<value_type, value_type, value_type>>
+            zipped;
+        auto append = bench::make_appender(zipped);
+        for (auto first = c.begin(), second = c.begin(), third = c.begin();
+             first != c.end(); ++first, ++second, ++third) {
+            append(*first, *second, *third);
+        }
+        benchmark::DoNotOptimize(zipped);
+    }
+    set_items_processed(state);
+}
+
+// Traverses the zipped elements in place, rather than materializing them
+template <typename Container>
+void cec_zip_n_view(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        long total = 0;
+        for (const auto& row : c.zip_n_view(c, c)) {
+            total +=
+                bench::key(std::get<0>(row)) + bench::key(std::get<2>(row));
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    set_items_processed(state);
+}
+
+template <typename Container>
+void stl_zip_n_view(benchmark::State& state) {
+    auto c = bench::make_container<Container>(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        long total = 0;
+        for (auto first = c.begin(), second = c.begin(), third = c.begin();
+             first != c.end(); ++first, ++second, ++third) {
+            total += bench::key(*first) + bench::key(*third);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+    set_items_processed(state);
+}
+
+} // end anonymous namespace
+
+// Register the CEC and hand written forms of 'op' for every container of T
+#define CEC_BENCHMARK_CONTAINERS(op, T)                                        \
+    CEC_BENCHMARK_RANDOM_ACCESS(op, T);                                        \
+    BENCHMARK_TEMPLATE(cec_##op, cec::list<T>)->Apply(bench::sizes);           \
+    BENCHMARK_TEMPLATE(stl_##op, cec::list<T>)->Apply(bench::sizes)
+
+#define CEC_BENCHMARK_RANDOM_ACCESS(op, T)                                     \
+    BENCHMARK_TEMPLATE(cec_##op, cec::vector<T>)->Apply(bench::sizes);         \
+    BENCHMARK_TEMPLATE(stl_##op, cec::vector<T>)->Apply(bench::sizes);         \
+    BENCHMARK_TEMPLATE(cec_##op, cec::deque<T>)->Apply(bench::sizes);          \
+    BENCHMARK_TEMPLATE(stl_##op, cec::deque<T>)->Apply(bench::sizes)
+
+// Operations which forward_list supports
+#define CEC_BENCHMARK_ALL(op, T)                                               \
+    CEC_BENCHMARK_CONTAINERS(op, T);                                           \
+    BENCHMARK_TEMPLATE(cec_##op, cec::forward_list<T>)->Apply(bench::sizes);   \
+    BENCHMARK_TEMPLATE(stl_##op, cec::forward_list<T>)->Apply(bench::sizes)
+
+CEC_BENCHMARK_ALL(concat, int);
+CEC_BENCHMARK_ALL(concat, cec::string);
+
+CEC_BENCHMARK_ALL(contains, int);
+CEC_BENCHMARK_ALL(contains, cec::string);
+
+CEC_BENCHMARK_ALL(count, int);
+CEC_BENCHMARK_ALL(count, cec::string);
+
+CEC_BENCHMARK_ALL(count_if, int);
+CEC_BENCHMARK_ALL(count_if, double);
+CEC_BENCHMARK_ALL(count_if, cec::string);
+
+CEC_BENCHMARK_ALL(distinct, int);
+CEC_BENCHMARK_ALL(distinct, cec::string);
+
+CEC_BENCHMARK_ALL(erase_all, int);
+CEC_BENCHMARK_ALL(erase_all, cec::string);
+
+CEC_BENCHMARK_ALL(erase_if, int);
+CEC_BENCHMARK_ALL(erase_if, cec::string);
+
+CEC_BENCHMARK_ALL(extend, int);
+CEC_BENCHMARK_ALL(extend, cec::string);
+
+CEC_BENCHMARK_ALL(filter, int);
+CEC_BENCHMARK_ALL(filter, double);
+CEC_BENCHMARK_ALL(filter, cec::string);
+
+CEC_BENCHMARK_ALL(flatten, int);
+CEC_BENCHMARK_ALL(flatten, cec::string);
+
+CEC_BENCHMARK_ALL(flatten_all, int);
+CEC_BENCHMARK_ALL(flatten_all, cec::string);
+
+CEC_BENCHMARK_ALL(flat_map, int);
+CEC_BENCHMARK_ALL(flat_map, cec::string);
+
+CEC_BENCHMARK_ALL(flat_map_containers, int);
+CEC_BENCHMARK_ALL(flat_map_containers, cec::string);
+
+CEC_BENCHMARK_ALL(group_by, int);
+CEC_BENCHMARK_ALL(group_by, cec::string);
+
+CEC_BENCHMARK_ALL(map, int);
+CEC_BENCHMARK_ALL(map, double);
+CEC_BENCHMARK_ALL(map, cec::string);
+
+CEC_BENCHMARK_ALL(partition, int);
+CEC_BENCHMARK_ALL(partition, cec::string);
+
+CEC_BENCHMARK_ALL(reduce, int);
+CEC_BENCHMARK_ALL(reduce, double);
+CEC_BENCHMARK_ALL(reduce, cec::string);
+
+CEC_BENCHMARK_ALL(sort, int);
+CEC_BENCHMARK_ALL(sort, double);
+CEC_BENCHMARK_ALL(sort, cec::string);
+
+CEC_BENCHMARK_ALL(take, int);
+CEC_BENCHMARK_ALL(take, cec::string);
+
+CEC_BENCHMARK_ALL(take_while, int);
+CEC_BENCHMARK_ALL(take_while, cec::string);
+
+CEC_BENCHMARK_ALL(transform, int);
+CEC_BENCHMARK_ALL(transform, double);
+CEC_BENCHMARK_ALL(transform, cec::string);
+
+CEC_BENCHMARK_ALL(unzip, int);
+CEC_BENCHMARK_ALL(unzip, cec::string);
+
+CEC_BENCHMARK_ALL(zip, int);
+CEC_BENCHMARK_ALL(zip, cec::string);
+
+CEC_BENCHMARK_ALL(zip_n, int);
+CEC_BENCHMARK_ALL(zip_n, cec::string);
+
+CEC_BENCHMARK_ALL(zip_n_view, int);
+CEC_BENCHMARK_ALL(zip_n_view, cec::string);
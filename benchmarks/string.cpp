@@ -0,0 +1,309 @@
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <cec/string.hpp>
+#include <cec/string_builder.hpp>
+#include <cec/vector.hpp>
+#include "support.hpp"
+
+// As in sequence_container.cpp, each operation is measured through CEC
+// ('cec_*') and as the equivalent hand written code ('stl_*'). Sizes are
+// numbers of words (for split and join) or of characters.
+
+namespace {
+
+// 'words' space separated words of mixed case
+cec::string make_sentence(std::size_t words) {
+    cec::string sentence;
+    for (std::size_t i = 0; i < words; ++i) {
+        if (i != 0) {
+            sentence += ' ';
+        }
+        sentence += bench::make_value<cec::string>(i);
+        sentence += (i % 3 == 0) ? "Word" : "word";
+    }
+    return sentence;
+}
+
+// A sentence of at least 'size' characters, cut down to exactly 'size'
+cec::string make_text(std::size_t size) {
+    cec::string text = make_sentence(size / 4 + 1);
+    text.resize(size);
+    return text;
+}
+
+void set_items_processed(benchmark::State& state) {
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                            state.range(0));
+}
+
+void cec_split(benchmark::State& state) {
+    auto sentence = make_sentence(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sentence.split());
+    }
+    set_items_processed(state);
+}
+
+void stl_split(benchmark::State& state) {
+    auto sentence = make_sentence(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::vector<std::string> words;
+        std::size_t first = 0;
+        for (;;) {
+            auto last = sentence.find(' ', first);
+            words.push_back(sentence.substr(first, last - first));
+            if (last == std::string::npos) {
+                break;
+            }
+            first = last + 1;
+        }
+        benchmark::DoNotOptimize(words);
+    }
+    set_items_processed(state);
+}
+
+#ifdef CEC_HAS_STRING_VIEW
+void cec_split_view(benchmark::State& state) {
+    auto sentence = make_sentence(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(sentence.split_view(' '));
+    }
+    set_items_processed(state);
+}
+#endif
+
+void cec_join(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    cec::string delimiter = ", ";
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(delimiter.join(parts));
+    }
+    set_items_processed(state);
+}
+
+void stl_join(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    std::string delimiter = ", ";
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::string joined;
+        for (std::size_t i = 0; i < parts.size(); ++i) {
+            if (i != 0) {
+                joined += delimiter;
+            }
+            joined += parts[i];
+        }
+        benchmark::DoNotOptimize(joined);
+    }
+    set_items_processed(state);
+}
+
+// Concatenating with reduce, as in its documentation. Before C++20,
+// std::accumulate copies the accumulator at each step.
+struct append_word {
+    std::string operator()(std::string msg, const cec::string& word) const {
+        msg += word;
+        return msg;
+    }
+};
+
+void cec_reduce_concat(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parts.reduce(append_word{}, std::string()));
+    }
+    set_items_processed(state);
+}
+
+void stl_reduce_concat(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(
+            parts.begin(), parts.end(), std::string(), append_word{}));
+    }
+    set_items_processed(state);
+}
+
+void cec_string_builder(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        cec::string_builder builder;
+        for (const auto& part : parts) {
+            builder << part << '\n';
+        }
+        benchmark::DoNotOptimize(builder.str());
+    }
+    set_items_processed(state);
+}
+
+void stl_string_builder(benchmark::State& state) {
+    auto parts = make_sentence(state.range(0)).split();
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::ostringstream stream;
+        for (const auto& part : parts) {
+            stream << part << '\n';
+        }
+        benchmark::DoNotOptimize(stream.str());
+    }
+    set_items_processed(state);
+}
+
+void cec_to_lower(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.to_lower());
+    }
+    set_items_processed(state);
+}
+
+void stl_to_lower(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::string lowered(text);
+        std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                       [](unsigned char c) { return std::tolower(c); });
+        benchmark::DoNotOptimize(lowered);
+    }
+    set_items_processed(state);
+}
+
+void cec_to_upper(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.to_upper());
+    }
+    set_items_processed(state);
+}
+
+void stl_to_upper(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::string uppered(text);
+        std::transform(uppered.begin(), uppered.end(), uppered.begin(),
+                       [](unsigned char c) { return std::toupper(c); });
+        benchmark::DoNotOptimize(uppered);
+    }
+    set_items_processed(state);
+}
+
+// Character level operations of extended_sequence_container on a string
+void cec_string_contains(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.contains('#'));
+    }
+    set_items_processed(state);
+}
+
+void stl_string_contains(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.find('#') != std::string::npos);
+    }
+    set_items_processed(state);
+}
+
+// Searching for a word that never occurs, but whose first and last
+// characters frequently do
+void cec_string_contains_substring(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.contains("word#d"));
+    }
+    set_items_processed(state);
+}
+
+void stl_string_contains_substring(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.find("word#d") != std::string::npos);
+    }
+    set_items_processed(state);
+}
+
+void cec_string_count(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(text.count(' '));
+    }
+    set_items_processed(state);
+}
+
+void stl_string_count(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::count(text.begin(), text.end(), ' '));
+    }
+    set_items_processed(state);
+}
+
+void cec_string_filter(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            text.filter([](char c) { return std::isalpha(c) != 0; }));
+    }
+    set_items_processed(state);
+}
+
+void stl_string_filter(benchmark::State& state) {
+    auto text = make_text(state.range(0));
+    bench::allocation_report report(state);
+    for (auto _ : state) {
+        std::string filtered;
+        for (char c : text) {
+            if (std::isalpha(c)) {
+                filtered += c;
+            }
+        }
+        benchmark::DoNotOptimize(filtered);
+    }
+    set_items_processed(state);
+}
+
+} // end anonymous namespace
+
+#define CEC_BENCHMARK_STRING(op)                                               \
+    BENCHMARK(cec_##op)->Apply(bench::sizes);                                  \
+    BENCHMARK(stl_##op)->Apply(bench::sizes)
+
+CEC_BENCHMARK_STRING(join);
+// The copying version is quadratic, so is only run on smaller inputs
+BENCHMARK(cec_reduce_concat)->RangeMultiplier(16)->Range(64, 1 << 14);
+BENCHMARK(stl_reduce_concat)->RangeMultiplier(16)->Range(64, 1 << 14);
+CEC_BENCHMARK_STRING(split);
+#ifdef CEC_HAS_STRING_VIEW
+BENCHMARK(cec_split_view)->Apply(bench::sizes);
+#endif
+CEC_BENCHMARK_STRING(string_builder);
+CEC_BENCHMARK_STRING(string_contains);
+CEC_BENCHMARK_STRING(string_contains_substring);
+CEC_BENCHMARK_STRING(string_count);
+CEC_BENCHMARK_STRING(string_filter);
+CEC_BENCHMARK_STRING(to_lower);
+CEC_BENCHMARK_STRING(to_upper);
@@ -0,0 +1,165 @@
+#ifndef CEC_BENCHMARKS_SUPPORT
+#define CEC_BENCHMARKS_SUPPORT
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <benchmark/benchmark.h>
+#include <cec/string.hpp>
+
+namespace bench {
+
+// Running totals of calls to operator new, maintained by the replacement
+// operators in main.cpp
+extern std::atomic<std::size_t> allocation_count;
+extern std::atomic<std::size_t> allocated_bytes;
+
+// Records the allocations made during its lifetime, and reports them as
+// per-iteration counters of 'state'. Construct it after any setup which
+// should not be counted.
+class allocation_report {
+public:
+    explicit allocation_report(benchmark::State& state)
+        : state_(state), count_(allocation_count.load()),
+          bytes_(allocated_bytes.load()) {}
+
+    ~allocation_report() {
+        state_.counters["allocs"] =
+            benchmark::Counter(static_cast<double>(allocation_count - count_),
+                               benchmark::Counter::kAvgIterations);
+        state_.counters["bytes"] =
+            benchmark::Counter(static_cast<double>(allocated_bytes - bytes_),
+                               benchmark::Counter::kAvgIterations);
+    }
+
+    allocation_report(const allocation_report&) = delete;
+    allocation_report& operator=(const allocation_report&) = delete;
+
+private:
+    benchmark::State& state_;
+    std::size_t count_;
+    std::size_t bytes_;
+};
+
+// The container sizes every benchmark is run with
+inline void sizes(benchmark::internal::Benchmark* b) {
+    b->RangeMultiplier(16)->Range(64, 1 << 18);
+}
+
+// Spread consecutive indexes over a wide range, so that e.g. sorts have
+// work to do
+inline std::uint32_t scramble(std::size_t i) {
+    return static_cast<std::uint32_t>(i * 2654435761u) % 1000003u;
+}
+
+template <typename T>
+T make_value(std::size_t i, std::true_type) {
+    return static_cast<T>(scramble(i));
+}
+
+template <typename T>
+T make_value(std::size_t i, std::false_type) {
+    return T(std::to_string(scramble(i)));
+}
+
+// A value of type T (arithmetic or string) derived from 'i'. Values are
+// never negative, so make_value<T>(-1) style lookups always miss.
+template <typename T>
+T make_value(std::size_t i) {
+    return make_value<T>(i, std::is_arithmetic<T>{});
+}
+
+// A value which make_value never produces
+template <typename T>
+T missing_value(std::true_type) {
+    return static_cast<T>(-1);
+}
+
+template <typename T>
+T missing_value(std::false_type) {
+    return T("missing");
+}
+
+template <typename T>
+T missing_value() {
+    return missing_value<T>(std::is_arithmetic<T>{});
+}
+
+template <typename T>
+long key(const T& value, std::true_type) {
+    return static_cast<long>(value);
+}
+
+template <typename T>
+long key(const T& value, std::false_type) {
+    return value.empty() ? 0 : static_cast<long>(value.back());
+}
+
+// A number derived from a value, used by predicates and reductions so that
+// they work the same way for every element type
+template <typename T>
+long key(const T& value) {
+    return key(value, std::is_arithmetic<T>{});
+}
+
+// 'Container' with its value_type replaced by T, as an extended container
+template <typename Container, typename T>
+using rebind_t = cec::extended_sequence_container<
+    typename cec::detail::rebind_sequence_container<
+        typename Container::container_type>::template other<T>>;
+
+// Appends to the end of a sequence container, the way a hand written loop
+// would. forward_list has no push_back, so its last element is tracked.
+template <typename Container, typename = void>
+class appender {
+public:
+    explicit appender(Container& c) : c_(c) {}
+
+    template <typename... Args>
+    void operator()(Args&&... args) {
+        c_.emplace_back(std::forward<Args>(args)...);
+    }
+
+private:
+    Container& c_;
+};
+
+template <typename Container>
+class appender<Container,
+               decltype(std::declval<Container&>().before_begin(), void())> {
+public:
+    explicit appender(Container& c) : c_(c), tail_(c.before_begin()) {}
+
+    template <typename... Args>
+    void operator()(Args&&... args) {
+        tail_ = c_.emplace_after(tail_, std::forward<Args>(args)...);
+    }
+
+private:
+    Container& c_;
+    typename Container::iterator tail_;
+};
+
+template <typename Container>
+appender<Container> make_appender(Container& c) {
+    return appender<Container>(c);
+}
+
+// A container of 'size' values from make_value
+template <typename Container>
+Container make_container(std::size_t size) {
+    Container c;
+    auto append = make_appender(c);
+    for (std::size_t i = 0; i < size; ++i) {
+        append(make_value<typename Container::value_type>(i));
+    }
+    return c;
+}
+
+} // end bench
+
+#endif
@@ -0,0 +1,361 @@
+#ifndef CEC_ARENA
+#define CEC_ARENA
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cec/detail/extended_sequence_container.hpp>
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
+
+namespace cec {
+
+/**
+ * @brief A monotonic (bump) allocator for the temporaries of a block of code
+ *
+ * While a scoped_arena is alive, it is the current arena of the thread
+ * which created it, and every container produced by an extended operation
+ * (map, filter, split, ...) on a container using arena_allocator (or, when
+ * available, std::pmr::polymorphic_allocator) is allocated from it. Memory
+ * is handed out by advancing a pointer through large blocks, deallocation
+ * does nothing, and all of the blocks are released at once when the arena
+ * is destroyed. The previously current arena (if any) is then restored, so
+ * arenas may be nested.
+ *
+ * Containers allocated from an arena must not outlive it. A result which
+ * must be kept can be copied: copies of a container using arena_allocator
+ * are allocated from the arena current at the time of the copy, or from the
+ * heap if there is none.
+ *
+ * Example Usage:
+ * @code
+ *    cec::vector<cec::string, cec::arena_allocator<cec::string>> lines =
+ *        read_lines();
+ *    std::size_t errors;
+ *    {
+ *        cec::scoped_arena arena;
+ *        // The intermediate containers are all allocated from 'arena'
+ *        errors = lines.map(parse).filter(is_error).size();
+ *        // arena.peak_bytes() is the most memory in use at any one time
+ *    }
+ * @endcode
+ */
+class scoped_arena {
+public:
+    /**
+     * @brief Create an arena, and make it the current arena of this thread
+     *
+     * @param[in] block_size - The size of the first block of memory. Each
+     *                         further block is twice the size of the last.
+     */
+    explicit scoped_arena(std::size_t block_size = 4096)
+        : previous_(current_slot()), owner_(std::this_thread::get_id()),
+          owned_(block_size), shared_(block_size) {
+#ifdef CEC_HAS_MEMORY_RESOURCE
+        resource_.arena_ = this;
+        detail::output_resource() = &resource_;
+#endif
+        current_slot() = this;
+    }
+
+    /**
+     * @brief Release all memory allocated from this arena, and restore the
+     * previously current arena
+     */
+    ~scoped_arena() {
+        current_slot() = previous_;
+#ifdef CEC_HAS_MEMORY_RESOURCE
+        detail::output_resource() =
+            previous_ ? previous_->resource() : nullptr;
+#endif
+    }
+
+    scoped_arena(const scoped_arena&) = delete;
+    scoped_arena& operator=(const scoped_arena&) = delete;
+
+    /**
+     * @brief The current arena of the calling thread, or \a nullptr if there
+     * is none
+     */
+    static scoped_arena* current() { return current_slot(); }
+
+    /**
+     * @brief Allocate \a bytes bytes aligned to \a alignment
+     *
+     * Allocations may be made concurrently, e.g., by a parallel map. Those
+     * made by the thread which created the arena do not lock it, while
+     * those made by other threads share a separate set of blocks under a
+     * lock.
+     */
+    void* allocate(std::size_t bytes, std::size_t alignment) {
+        if (std::this_thread::get_id() == owner_) {
+            return owned_.allocate(bytes, alignment, shared_);
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return shared_.allocate(bytes, alignment, owned_);
+    }
+
+    /**
+     * @brief Record that \a bytes bytes are no longer in use. The memory
+     * itself is only released when the arena is destroyed.
+     */
+    void deallocate(void*, std::size_t bytes) {
+        if (std::this_thread::get_id() == owner_) {
+            owned_.deallocate(bytes);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        shared_.deallocate(bytes);
+    }
+
+    /// The number of allocations made from this arena
+    std::size_t allocation_count() const {
+        return owned_.allocation_count() + shared_.allocation_count();
+    }
+
+    /// The total number of bytes allocated from this arena
+    std::size_t bytes_allocated() const {
+        return owned_.bytes_allocated() + shared_.bytes_allocated();
+    }
+
+    /// The number of allocated bytes which have not been deallocated
+    std::size_t bytes_in_use() const {
+        return owned_.bytes_in_use() + shared_.bytes_in_use();
+    }
+
+    /// The largest value of bytes_in_use() so far
+    std::size_t peak_bytes() const {
+        return std::max(owned_.peak_bytes(), shared_.peak_bytes());
+    }
+
+    /// The total size of the blocks obtained from the heap
+    std::size_t bytes_reserved() const {
+        return owned_.bytes_reserved() + shared_.bytes_reserved();
+    }
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+    /**
+     * @brief A std::pmr::memory_resource allocating from this arena
+     */
+    std::pmr::memory_resource* resource() { return &resource_; }
+#endif
+
+private:
+    static scoped_arena*& current_slot() {
+        static thread_local scoped_arena* current = nullptr;
+        return current;
+    }
+
+    // Blocks of memory, and statistics of the allocations made from them.
+    // A region is only modified by one thread at a time (the owner of the
+    // arena, or another thread holding the lock), so its counters are
+    // updated with plain loads and stores. They are atomic so that they can
+    // be read from any thread.
+    class region {
+    public:
+        explicit region(std::size_t block_size)
+            : next_block_size_(block_size), position_(nullptr), end_(nullptr),
+              allocation_count_(0), bytes_allocated_(0), bytes_in_use_(0),
+              peak_bytes_(0), bytes_reserved_(0) {}
+
+        ~region() {
+            for (void* block : blocks_) {
+                ::operator delete(block);
+            }
+        }
+
+        region(const region&) = delete;
+        region& operator=(const region&) = delete;
+
+        // Bump allocate from the current block. The peak is of the bytes
+        // in use in both this region and 'other'.
+        void* allocate(std::size_t bytes, std::size_t alignment,
+                       const region& other) {
+            std::size_t padding = padding_for(alignment);
+            if (position_ == nullptr ||
+                padding + bytes > static_cast<std::size_t>(end_ - position_)) {
+                add_block(bytes + alignment);
+                padding = padding_for(alignment);
+            }
+
+            void* allocated = position_ + padding;
+            position_ += padding + bytes;
+
+            add(allocation_count_, 1);
+            add(bytes_allocated_, bytes);
+            add(bytes_in_use_, bytes);
+            std::size_t in_use = bytes_in_use() + other.bytes_in_use();
+            if (in_use > peak_bytes()) {
+                peak_bytes_.store(in_use, std::memory_order_relaxed);
+            }
+            return allocated;
+        }
+
+        // Memory allocated from either region may be deallocated in either,
+        // so bytes_in_use() may wrap around, but the sum of the two
+        // regions does not
+        void deallocate(std::size_t bytes) { add(bytes_in_use_, 0 - bytes); }
+
+        std::size_t allocation_count() const { return load(allocation_count_); }
+        std::size_t bytes_allocated() const { return load(bytes_allocated_); }
+        std::size_t bytes_in_use() const { return load(bytes_in_use_); }
+        std::size_t peak_bytes() const { return load(peak_bytes_); }
+        std::size_t bytes_reserved() const { return load(bytes_reserved_); }
+
+    private:
+        static std::size_t load(const std::atomic<std::size_t>& counter) {
+            return counter.load(std::memory_order_relaxed);
+        }
+
+        static void add(std::atomic<std::size_t>& counter, std::size_t n) {
+            counter.store(load(counter) + n, std::memory_order_relaxed);
+        }
+
+        // The number of bytes to skip for the next allocation to be aligned
+        std::size_t padding_for(std::size_t alignment) const {
+            auto address = reinterpret_cast<std::uintptr_t>(position_);
+            return (alignment - address % alignment) % alignment;
+        }
+
+        void add_block(std::size_t needed) {
+            std::size_t size = std::max(next_block_size_, needed);
+            blocks_.reserve(blocks_.size() + 1);
+            position_ = static_cast<char*>(::operator new(size));
+            blocks_.push_back(position_);
+            end_ = position_ + size;
+            add(bytes_reserved_, size);
+            next_block_size_ = size * 2;
+        }
+
+        std::vector<void*> blocks_;
+        std::size_t next_block_size_;
+        char* position_;
+        char* end_;
+        std::atomic<std::size_t> allocation_count_;
+        std::atomic<std::size_t> bytes_allocated_;
+        std::atomic<std::size_t> bytes_in_use_;
+        std::atomic<std::size_t> peak_bytes_;
+        std::atomic<std::size_t> bytes_reserved_;
+    };
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+    class arena_resource : public std::pmr::memory_resource {
+        friend class scoped_arena;
+
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+            return arena_->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, std::size_t bytes, std::size_t) override {
+            arena_->deallocate(p, bytes);
+        }
+
+        bool do_is_equal(
+            const std::pmr::memory_resource& other) const noexcept override {
+            return this == &other;
+        }
+
+        scoped_arena* arena_;
+    };
+
+    arena_resource resource_;
+#endif
+
+    scoped_arena* previous_;
+    std::thread::id owner_;
+
+    // Allocations made by the owning thread, and (under the lock) by any
+    // other thread
+    region owned_;
+    region shared_;
+    std::mutex mutex_;
+};
+
+/**
+ * @brief An allocator which allocates from a scoped_arena, or from the heap
+ * if it has none
+ *
+ * A default constructed arena_allocator uses the current arena of the
+ * calling thread. Containers using an arena_allocator produce the results
+ * of extended operations in the current arena, even if they were
+ * themselves created outside of it.
+ */
+template <typename T>
+class arena_allocator {
+public:
+    using value_type = T;
+
+    /**
+     * @brief Create an allocator using the current arena, or the heap if
+     * there is none
+     */
+    arena_allocator() : arena_(scoped_arena::current()) {}
+
+    /**
+     * @brief Create an allocator using \a arena (the heap if \a nullptr)
+     */
+    explicit arena_allocator(scoped_arena* arena) : arena_(arena) {}
+
+    template <typename U>
+    arena_allocator(const arena_allocator<U>& other) : arena_(other.arena()) {}
+
+    T* allocate(std::size_t n) {
+        if (arena_ == nullptr) {
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+        return static_cast<T*>(arena_->allocate(n * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* p, std::size_t n) {
+        if (arena_ == nullptr) {
+            ::operator delete(p);
+        } else {
+            arena_->deallocate(p, n * sizeof(T));
+        }
+    }
+
+    // Copies of a container are allocated from the arena current at the
+    // time of the copy, so results can be copied out of an arena
+    arena_allocator select_on_container_copy_construction() const {
+        return arena_allocator();
+    }
+
+    /// The arena allocated from, or \a nullptr for the heap
+    scoped_arena* arena() const { return arena_; }
+
+private:
+    scoped_arena* arena_;
+};
+
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& lhs, const arena_allocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+namespace detail {
+
+// While an arena is current, the results of operations on containers using
+// arena_allocator are allocated from it
+template <typename T>
+struct output_allocator<arena_allocator<T>> {
+    static arena_allocator<T> select(const arena_allocator<T>& allocator) {
+        return scoped_arena::current() ? arena_allocator<T>() : allocator;
+    }
+};
+} // end detail
+} // end cec
+
+#endif
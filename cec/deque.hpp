@@ -4,6 +4,10 @@
 #include <deque>
 #include <cec/extended_sequence_container.hpp>
 
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
+
 namespace cec {
 
 /**
@@ -11,6 +15,18 @@ namespace cec {
  */
 template <typename T, typename Allocator = std::allocator<T>>
 using deque = cec::extended_sequence_container<std::deque<T, Allocator>>;
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+namespace pmr {
+
+/**
+ * @brief A convenience alias for extended std::deque using a polymorphic
+ * allocator
+ */
+template <typename T>
+using deque = cec::deque<T, std::pmr::polymorphic_allocator<T>>;
+}
+#endif
 }
 
 #endif
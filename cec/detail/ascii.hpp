@@ -0,0 +1,189 @@
+#ifndef CEC_ASCII_DETAIL
+#define CEC_ASCII_DETAIL
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <cec/detail/cpu.hpp>
+
+namespace cec {
+namespace detail {
+
+// The case of an ASCII letter is determined by bit 5 (0x20), so converting
+// case is a matter of flipping that bit for every character in the range
+// [first, first + 26). The comparisons are performed on unsigned values, so
+// that non-ASCII characters (including each byte of a multi-byte UTF-8
+// sequence) are left unchanged.
+template <typename CharT>
+void ascii_flip_case_scalar(CharT* data, std::size_t size, CharT first) {
+    using unsigned_type = typename std::make_unsigned<CharT>::type;
+    for (std::size_t i = 0; i < size; ++i) {
+        auto c = static_cast<unsigned_type>(data[i]);
+        auto in_range = static_cast<unsigned_type>(
+                            c - static_cast<unsigned_type>(first)) < 26;
+        data[i] = static_cast<CharT>(c ^ (in_range << 5));
+    }
+}
+
+// Identifies the vector kernels for characters of type CharT by their size
+// in bytes, or 0 for the scalar loop
+template <typename CharT>
+using ascii_kind = std::integral_constant<
+    std::size_t, std::is_integral<CharT>::value &&
+                         (sizeof(CharT) == 1 || sizeof(CharT) == 2 ||
+                          sizeof(CharT) == 4)
+                     ? sizeof(CharT)
+                     : 0>;
+
+// The vector kernels shift the range of letters to begin at the smallest
+// signed value of each lane (by adding 'shift', with wrap around), which
+// allows a single signed comparison against 'bound'. They return the bits
+// to flip for each character of 'chars'.
+#ifdef CEC_X86_DISPATCH
+CEC_TARGET("avx2")
+inline __m256i ascii_case_bits_avx2(__m256i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 1>) {
+    __m256i shifted = _mm256_add_epi8(
+        chars, _mm256_set1_epi8(static_cast<char>(0x80u - first)));
+    __m256i in_range = _mm256_cmpgt_epi8(
+        _mm256_set1_epi8(static_cast<char>(-0x80 + 26)), shifted);
+    return _mm256_and_si256(in_range, _mm256_set1_epi8(0x20));
+}
+
+CEC_TARGET("avx2")
+inline __m256i ascii_case_bits_avx2(__m256i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 2>) {
+    __m256i shifted = _mm256_add_epi16(
+        chars, _mm256_set1_epi16(static_cast<short>(0x8000u - first)));
+    __m256i in_range = _mm256_cmpgt_epi16(
+        _mm256_set1_epi16(static_cast<short>(-0x8000 + 26)), shifted);
+    return _mm256_and_si256(in_range, _mm256_set1_epi16(0x20));
+}
+
+CEC_TARGET("avx2")
+inline __m256i ascii_case_bits_avx2(__m256i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 4>) {
+    __m256i shifted = _mm256_add_epi32(
+        chars, _mm256_set1_epi32(static_cast<int>(0x80000000u - first)));
+    __m256i in_range = _mm256_cmpgt_epi32(
+        _mm256_set1_epi32(std::numeric_limits<int>::min() + 26), shifted);
+    return _mm256_and_si256(in_range, _mm256_set1_epi32(0x20));
+}
+
+template <typename CharT, std::size_t Kind>
+CEC_TARGET("avx2")
+void ascii_flip_case_avx2(CharT* data, std::size_t size, CharT first,
+                          std::integral_constant<std::size_t, Kind> kind) {
+    using unsigned_type = typename std::make_unsigned<CharT>::type;
+    const auto bits = static_cast<std::uint32_t>(
+        static_cast<unsigned_type>(first));
+    constexpr std::size_t lanes = 32 / sizeof(CharT);
+
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        __m256i* block = reinterpret_cast<__m256i*>(data + i);
+        __m256i chars = _mm256_loadu_si256(block);
+        _mm256_storeu_si256(
+            block,
+            _mm256_xor_si256(chars, ascii_case_bits_avx2(chars, bits, kind)));
+    }
+    ascii_flip_case_scalar(data + i, size - i, first);
+}
+#endif
+
+#ifdef CEC_HAS_SSE2
+inline __m128i ascii_case_bits_sse2(__m128i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 1>) {
+    __m128i shifted =
+        _mm_add_epi8(chars, _mm_set1_epi8(static_cast<char>(0x80u - first)));
+    __m128i in_range = _mm_cmplt_epi8(
+        shifted, _mm_set1_epi8(static_cast<char>(-0x80 + 26)));
+    return _mm_and_si128(in_range, _mm_set1_epi8(0x20));
+}
+
+inline __m128i ascii_case_bits_sse2(__m128i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 2>) {
+    __m128i shifted = _mm_add_epi16(
+        chars, _mm_set1_epi16(static_cast<short>(0x8000u - first)));
+    __m128i in_range = _mm_cmplt_epi16(
+        shifted, _mm_set1_epi16(static_cast<short>(-0x8000 + 26)));
+    return _mm_and_si128(in_range, _mm_set1_epi16(0x20));
+}
+
+inline __m128i ascii_case_bits_sse2(__m128i chars, std::uint32_t first,
+                                    std::integral_constant<std::size_t, 4>) {
+    __m128i shifted = _mm_add_epi32(
+        chars, _mm_set1_epi32(static_cast<int>(0x80000000u - first)));
+    __m128i in_range = _mm_cmplt_epi32(
+        shifted, _mm_set1_epi32(std::numeric_limits<int>::min() + 26));
+    return _mm_and_si128(in_range, _mm_set1_epi32(0x20));
+}
+
+template <typename CharT, std::size_t Kind>
+void ascii_flip_case_sse2(CharT* data, std::size_t size, CharT first,
+                          std::integral_constant<std::size_t, Kind> kind) {
+    using unsigned_type = typename std::make_unsigned<CharT>::type;
+    const auto bits = static_cast<std::uint32_t>(
+        static_cast<unsigned_type>(first));
+    constexpr std::size_t lanes = 16 / sizeof(CharT);
+
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        __m128i* block = reinterpret_cast<__m128i*>(data + i);
+        __m128i chars = _mm_loadu_si128(block);
+        _mm_storeu_si128(
+            block,
+            _mm_xor_si128(chars, ascii_case_bits_sse2(chars, bits, kind)));
+    }
+    ascii_flip_case_scalar(data + i, size - i, first);
+}
+#endif
+
+template <typename CharT>
+void ascii_flip_case_dispatch(CharT* data, std::size_t size, CharT first,
+                              std::integral_constant<std::size_t, 0>) {
+    ascii_flip_case_scalar(data, size, first);
+}
+
+template <typename CharT, std::size_t Kind>
+void ascii_flip_case_dispatch(CharT* data, std::size_t size, CharT first,
+                              std::integral_constant<std::size_t, Kind> kind) {
+#ifdef CEC_X86_DISPATCH
+    if (cpu_has_avx2()) {
+        ascii_flip_case_avx2(data, size, first, kind);
+        return;
+    }
+#endif
+#ifdef CEC_HAS_SSE2
+    ascii_flip_case_sse2(data, size, first, kind);
+#else
+    static_cast<void>(kind);
+    ascii_flip_case_scalar(data, size, first);
+#endif
+}
+
+// Characters of 1, 2 or 4 bytes (char, wchar_t, char16_t, char32_t) are
+// converted 32 bytes at a time with AVX2 where the processor supports it,
+// otherwise 16 bytes at a time with SSE2 where the target includes it.
+template <typename CharT>
+void ascii_flip_case(CharT* data, std::size_t size, CharT first) {
+    ascii_flip_case_dispatch(data, size, first, ascii_kind<CharT>{});
+}
+
+// Convert the ASCII letters of [data, data + size) to lower case in-place
+template <typename CharT>
+void ascii_to_lower(CharT* data, std::size_t size) {
+    ascii_flip_case(data, size, static_cast<CharT>('A'));
+}
+
+// Convert the ASCII letters of [data, data + size) to upper case in-place
+template <typename CharT>
+void ascii_to_upper(CharT* data, std::size_t size) {
+    ascii_flip_case(data, size, static_cast<CharT>('a'));
+}
+
+} // end detail
+} // end cec
+
+#endif
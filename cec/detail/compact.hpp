@@ -0,0 +1,252 @@
+#ifndef CEC_COMPACT_DETAIL
+#define CEC_COMPACT_DETAIL
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <cec/detail/cpu.hpp>
+
+namespace cec {
+namespace detail {
+
+// Stream compaction: copy the elements of [in, in + size) satisfying a
+// predicate to 'out', preserving their order, and return how many there
+// were. 'out' must have room for 'size' elements (the vector kernels store
+// whole blocks, of which only the leading survivors are meaningful), and may
+// be equal to 'in' to compact in-place, as no element is written before it
+// has been read.
+//
+// Rather than branching on each element, the predicate is evaluated for a
+// block of elements to build a mask, and the survivors of the block are
+// then compressed in to the output in one step. Every element is stored
+// and the output position advanced by whether it was kept, so the cost does
+// not depend on how predictable the predicate is.
+
+template <typename T, typename Predicate>
+std::size_t compact_scalar(const T* in, std::size_t size, T* out,
+                           Predicate& p) {
+    std::size_t kept = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        T value = in[i];
+        bool keep = static_cast<bool>(p(value));
+        out[kept] = value;
+        kept += keep;
+    }
+    return kept;
+}
+
+// A bit mask of the elements of [in, in + Lanes) satisfying p
+template <std::size_t Lanes, typename T, typename Predicate>
+unsigned compact_mask(const T* in, Predicate& p) {
+    unsigned mask = 0;
+    for (std::size_t lane = 0; lane < Lanes; ++lane) {
+        mask |= static_cast<unsigned>(static_cast<bool>(p(in[lane]))) << lane;
+    }
+    return mask;
+}
+
+#ifdef CEC_X86_DISPATCH
+// For each mask of 8 32-bit lanes (or 4 64-bit lanes, as pairs of 32-bit
+// lanes), the indexes of the set lanes followed by padding, as used by
+// _mm256_permutevar8x32_epi32 to move the kept lanes to the front
+struct compress_tables {
+    compress_tables() {
+        for (unsigned mask = 0; mask < 256; ++mask) {
+            unsigned kept = 0;
+            for (unsigned lane = 0; lane < 8; ++lane) {
+                if (mask & (1u << lane)) {
+                    lanes32[mask][kept++] = static_cast<std::uint8_t>(lane);
+                }
+            }
+            for (; kept < 8; ++kept) {
+                lanes32[mask][kept] = 0;
+            }
+        }
+
+        for (unsigned mask = 0; mask < 16; ++mask) {
+            unsigned kept = 0;
+            for (unsigned lane = 0; lane < 4; ++lane) {
+                if (mask & (1u << lane)) {
+                    lanes64[mask][kept++] = static_cast<std::uint8_t>(lane * 2);
+                    lanes64[mask][kept++] =
+                        static_cast<std::uint8_t>(lane * 2 + 1);
+                }
+            }
+            for (; kept < 8; ++kept) {
+                lanes64[mask][kept] = 0;
+            }
+        }
+    }
+
+    std::uint8_t lanes32[256][8];
+    std::uint8_t lanes64[16][8];
+};
+
+inline const compress_tables& get_compress_tables() {
+    static const compress_tables tables;
+    return tables;
+}
+
+template <typename T, typename Predicate>
+CEC_TARGET("avx2")
+std::size_t compact_avx2(const T* in, std::size_t size, T* out, Predicate& p,
+                         std::integral_constant<std::size_t, 4>) {
+    const compress_tables& tables = get_compress_tables();
+    std::size_t kept = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        unsigned mask = compact_mask<8>(in + i, p);
+        __m256i values =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(tables.lanes32[mask])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + kept),
+                            _mm256_permutevar8x32_epi32(values, lanes));
+        kept += __builtin_popcount(mask);
+    }
+    return kept + compact_scalar(in + i, size - i, out + kept, p);
+}
+
+template <typename T, typename Predicate>
+CEC_TARGET("avx2")
+std::size_t compact_avx2(const T* in, std::size_t size, T* out, Predicate& p,
+                         std::integral_constant<std::size_t, 8>) {
+    const compress_tables& tables = get_compress_tables();
+    std::size_t kept = 0;
+    std::size_t i = 0;
+    for (; i + 4 <= size; i += 4) {
+        unsigned mask = compact_mask<4>(in + i, p);
+        __m256i values =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        __m256i lanes = _mm256_cvtepu8_epi32(_mm_loadl_epi64(
+            reinterpret_cast<const __m128i*>(tables.lanes64[mask])));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + kept),
+                            _mm256_permutevar8x32_epi32(values, lanes));
+        kept += __builtin_popcount(mask);
+    }
+    return kept + compact_scalar(in + i, size - i, out + kept, p);
+}
+
+template <typename T, typename Predicate>
+CEC_TARGET("avx512f")
+std::size_t compact_avx512(const T* in, std::size_t size, T* out,
+                           Predicate& p,
+                           std::integral_constant<std::size_t, 4>) {
+    std::size_t kept = 0;
+    std::size_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        unsigned mask = compact_mask<16>(in + i, p);
+        __m512i values = _mm512_loadu_si512(in + i);
+        _mm512_storeu_si512(
+            out + kept,
+            _mm512_maskz_compress_epi32(static_cast<__mmask16>(mask), values));
+        kept += __builtin_popcount(mask);
+    }
+    return kept + compact_scalar(in + i, size - i, out + kept, p);
+}
+
+template <typename T, typename Predicate>
+CEC_TARGET("avx512f")
+std::size_t compact_avx512(const T* in, std::size_t size, T* out,
+                           Predicate& p,
+                           std::integral_constant<std::size_t, 8>) {
+    std::size_t kept = 0;
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        unsigned mask = compact_mask<8>(in + i, p);
+        __m512i values = _mm512_loadu_si512(in + i);
+        _mm512_storeu_si512(
+            out + kept,
+            _mm512_maskz_compress_epi64(static_cast<__mmask8>(mask), values));
+        kept += __builtin_popcount(mask);
+    }
+    return kept + compact_scalar(in + i, size - i, out + kept, p);
+}
+
+// Elements of 4 or 8 bytes are compacted by the widest kernel the processor
+// supports, and any others by the scalar kernel
+template <typename T, typename Predicate, std::size_t Size>
+std::size_t compact_vector(const T* in, std::size_t size, T* out,
+                           Predicate& p,
+                           std::integral_constant<std::size_t, Size> width) {
+    if (cpu_has_avx512f()) {
+        return compact_avx512(in, size, out, p, width);
+    }
+    if (cpu_has_avx2()) {
+        return compact_avx2(in, size, out, p, width);
+    }
+    return compact_scalar(in, size, out, p);
+}
+
+template <typename T, typename Predicate>
+std::size_t compact_dispatch(const T* in, std::size_t size, T* out,
+                             Predicate& p,
+                             std::integral_constant<std::size_t, 4> width) {
+    return compact_vector(in, size, out, p, width);
+}
+
+template <typename T, typename Predicate>
+std::size_t compact_dispatch(const T* in, std::size_t size, T* out,
+                             Predicate& p,
+                             std::integral_constant<std::size_t, 8> width) {
+    return compact_vector(in, size, out, p, width);
+}
+
+template <typename T, typename Predicate, typename Width>
+std::size_t compact_dispatch(const T* in, std::size_t size, T* out,
+                             Predicate& p, Width) {
+    return compact_scalar(in, size, out, p);
+}
+#endif
+
+// Whether the elements of a T can be compacted by copying their bytes in
+// vector registers
+template <typename T>
+using is_compactable_element = std::is_arithmetic<T>;
+
+template <typename T, typename Predicate>
+std::size_t compact(const T* in, std::size_t size, T* out, Predicate& p) {
+#ifdef CEC_X86_DISPATCH
+    return compact_dispatch(in, size, out, p,
+                            std::integral_constant<std::size_t, sizeof(T)>{});
+#else
+    return compact_scalar(in, size, out, p);
+#endif
+}
+
+// Whether 'Container' stores arithmetic elements contiguously (i.e., it
+// provides data()), so that it can be filtered with compact()
+template <typename Container>
+auto is_compactable_helper(int) -> std::integral_constant<
+    bool, is_compactable_element<typename Container::value_type>::value &&
+              std::is_same<decltype(std::declval<const Container&>().data()),
+                           const typename Container::value_type*>::value>;
+
+template <typename Container>
+std::false_type is_compactable_helper(long);
+
+template <typename Container>
+using is_compactable = decltype(is_compactable_helper<Container>(0));
+
+// Elements are compacted through a buffer of this many elements when the
+// output is a separate container
+constexpr std::size_t compact_block_size = 256;
+
+// Append the elements of [in, in + size) satisfying p to 'out'
+template <typename Container, typename T, typename Predicate>
+void compact_append(Container& out, const T* in, std::size_t size,
+                    Predicate& p) {
+    T buffer[compact_block_size];
+    for (std::size_t i = 0; i < size; i += compact_block_size) {
+        std::size_t block = std::min(compact_block_size, size - i);
+        std::size_t kept = compact(in + i, block, buffer, p);
+        out.insert(out.end(), buffer, buffer + kept);
+    }
+}
+
+} // end detail
+} // end cec
+
+#endif
@@ -0,0 +1,18 @@
+#ifndef CEC_CONFIG_DETAIL
+#define CEC_CONFIG_DETAIL
+
+// Detection of the optional parts of the library which depend on a later
+// standard than C++11
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#if defined(__has_include)
+#if __has_include(<string_view>)
+#define CEC_HAS_STRING_VIEW 1
+#endif
+#if __has_include(<memory_resource>)
+#define CEC_HAS_MEMORY_RESOURCE 1
+#endif
+#endif
+#endif
+
+#endif
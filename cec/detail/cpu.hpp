@@ -0,0 +1,51 @@
+#ifndef CEC_CPU_DETAIL
+#define CEC_CPU_DETAIL
+
+// CEC_X86_DISPATCH is defined when kernels for instruction sets beyond the
+// compilation target can be compiled (with target attributes) and selected
+// at runtime. CEC_HAS_SSE2 is defined when SSE2 is part of the compilation
+// target, as it is for every x86-64 build.
+#if (defined(__GNUC__) || defined(__clang__)) &&                               \
+    (defined(__x86_64__) || defined(__i386__))
+#define CEC_X86_DISPATCH 1
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) ||                                   \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CEC_HAS_SSE2 1
+#endif
+
+#ifdef CEC_X86_DISPATCH
+#include <immintrin.h>
+#define CEC_TARGET(isa) __attribute__((target(isa)))
+#elif defined(CEC_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+
+namespace cec {
+namespace detail {
+
+// Whether the processor running this program supports AVX2
+inline bool cpu_has_avx2() {
+#ifdef CEC_X86_DISPATCH
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+// Whether the processor running this program supports AVX-512 Foundation
+inline bool cpu_has_avx512f() {
+#ifdef CEC_X86_DISPATCH
+    static const bool supported = __builtin_cpu_supports("avx512f");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // end detail
+} // end cec
+
+#endif
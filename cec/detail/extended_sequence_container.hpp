@@ -4,6 +4,13 @@
 #include <memory>
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cec/detail/config.hpp>
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
 
 namespace cec {
 namespace detail {
@@ -166,6 +173,19 @@ void advance_iter_tuple_helper(Tuple& tuple, index_pack<Indexes...>) {
         (std::advance(std::get<Indexes>(tuple), 1), 0)...);
 }
 
+// Forward an element of a container as an rvalue if 'Container' (as
+// deduced for a forwarding reference) is not an lvalue reference, so that
+// the elements of temporaries can be moved from. Elements of lvalues are
+// passed through unchanged.
+template <typename Container, typename T>
+auto forward_like(T&& element) -> typename std::conditional<
+    std::is_lvalue_reference<Container>::value, T&&,
+    typename std::remove_reference<T>::type&&>::type {
+    return static_cast<typename std::conditional<
+        std::is_lvalue_reference<Container>::value, T&&,
+        typename std::remove_reference<T>::type&&>::type>(element);
+}
+
 // Some sequence containers (like forward_list) do not have a size()
 // member function, so invoke std::distance to determine their size
 template <typename Container>
@@ -185,6 +205,453 @@ auto container_size(const Container& c)
     return container_size_helper(c, 0);
 }
 
+// Selects the allocator of a container produced by an operation (e.g., map)
+// on a container using 'Allocator', after rebinding it to the new element
+// type. By default the source's allocator is copied, so the results of an
+// operation on a container using a stateful allocator (e.g., an arena) are
+// allocated the same way. Specializations may substitute another allocator.
+template <typename Allocator>
+struct output_allocator {
+    static Allocator select(const Allocator& allocator) { return allocator; }
+};
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+// The memory resource which the results of operations on containers using a
+// polymorphic allocator are allocated from, or nullptr to use the resource
+// of the source. A scoped_arena sets this while it is current.
+inline std::pmr::memory_resource*& output_resource() {
+    static thread_local std::pmr::memory_resource* resource = nullptr;
+    return resource;
+}
+
+template <typename T>
+struct output_allocator<std::pmr::polymorphic_allocator<T>> {
+    static std::pmr::polymorphic_allocator<T>
+    select(const std::pmr::polymorphic_allocator<T>& allocator) {
+        if (std::pmr::memory_resource* resource = output_resource()) {
+            return std::pmr::polymorphic_allocator<T>(resource);
+        }
+        return allocator;
+    }
+};
+#endif
+
+// Whether a 'Target' can be constructed with the allocator of a 'Source'.
+// This is the case when rebinding the allocator of Source to the elements
+// of Target yields the allocator of Target.
+template <typename Target, typename Source, typename = void>
+struct is_allocator_rebindable : std::false_type {};
+
+template <typename Target, typename Source>
+struct is_allocator_rebindable<
+    Target, Source,
+    typename std::enable_if<std::is_same<
+        typename std::allocator_traits<typename Source::allocator_type>::
+            template rebind_alloc<typename Target::value_type>,
+        typename Target::allocator_type>::value>::type> : std::true_type {};
+
+template <typename Target, typename Source, typename... Args>
+Target make_rebound_helper(const Source& source, std::true_type,
+                           Args&&... args) {
+    using allocator_type = typename Target::allocator_type;
+    return Target(std::forward<Args>(args)...,
+                  output_allocator<allocator_type>::select(
+                      allocator_type(source.get_allocator())));
+}
+
+template <typename Target, typename Source, typename... Args>
+Target make_rebound_helper(const Source&, std::false_type, Args&&... args) {
+    return Target(std::forward<Args>(args)...);
+}
+
+// Construct a 'Target' from 'args' to hold the results of an operation on
+// 'source'. Where possible, it is given the allocator of 'source' rebound to
+// the elements of Target, rather than a default constructed allocator.
+template <typename Target, typename Source, typename... Args>
+Target make_rebound(const Source& source, Args&&... args) {
+    return make_rebound_helper<Target>(
+        source, is_allocator_rebindable<Target, Source>{},
+        std::forward<Args>(args)...);
+}
+
+// Determine whether T provides a size() member function
+template <typename T>
+auto has_size_helper(int)
+    -> decltype(std::declval<const T&>().size(), std::true_type{});
+
+template <typename T>
+std::false_type has_size_helper(long);
+
+template <typename T>
+using has_size = decltype(has_size_helper<T>(0));
+
+// Determine whether Container provides a reserve() member function
+template <typename Container>
+auto has_reserve_helper(int)
+    -> decltype(std::declval<Container&>().reserve(0), std::true_type{});
+
+template <typename Container>
+std::false_type has_reserve_helper(long);
+
+template <typename Container>
+using has_reserve = decltype(has_reserve_helper<Container>(0));
+
+template <typename Container, typename SizeFunction>
+void reserve_hint_helper(Container& c, SizeFunction size, std::true_type) {
+    c.reserve(c.size() + size());
+}
+
+template <typename Container, typename SizeFunction>
+void reserve_hint_helper(Container&, SizeFunction, std::false_type) {}
+
+// Reserve space for 'size()' more elements in 'c' if it supports reserve().
+// The size is only computed if it will be used, as it may be expensive to
+// determine (e.g., for forward_list).
+template <typename Container, typename SizeFunction>
+void reserve_hint(Container& c, SizeFunction size) {
+    reserve_hint_helper(c, size, has_reserve<Container>{});
+}
+
+// Store the result of a fold step in the accumulator, unless it is a
+// reference to the accumulator itself (i.e., 'f' updated it in place)
+template <typename T, typename Result>
+void fold_assign(T& accumulator, Result&& result) {
+    if (static_cast<const void*>(std::addressof(result)) !=
+        static_cast<const void*>(std::addressof(accumulator))) {
+        accumulator = std::forward<Result>(result);
+    }
+}
+
+// Determine whether 'f' accepts an rvalue accumulator
+template <typename BinaryFunction, typename T, typename U>
+auto accepts_rvalue_helper(int)
+    -> decltype(std::declval<BinaryFunction&>()(std::declval<T&&>(),
+                                                std::declval<U>()),
+                std::true_type{});
+
+template <typename BinaryFunction, typename T, typename U>
+std::false_type accepts_rvalue_helper(long);
+
+template <typename BinaryFunction, typename T, typename U>
+using accepts_rvalue = decltype(accepts_rvalue_helper<BinaryFunction, T, U>(0));
+
+template <typename T, typename BinaryFunction, typename U>
+void fold_step_helper(T& accumulator, BinaryFunction& f, U&& element,
+                      std::true_type) {
+    fold_assign(accumulator,
+                f(std::move(accumulator), std::forward<U>(element)));
+}
+
+template <typename T, typename BinaryFunction, typename U>
+void fold_update(T& accumulator, BinaryFunction& f, U&& element,
+                 std::true_type) {
+    f(accumulator, std::forward<U>(element));
+}
+
+template <typename T, typename BinaryFunction, typename U>
+void fold_update(T& accumulator, BinaryFunction& f, U&& element,
+                 std::false_type) {
+    fold_assign(accumulator, f(accumulator, std::forward<U>(element)));
+}
+
+template <typename T, typename BinaryFunction, typename U>
+void fold_step_helper(T& accumulator, BinaryFunction& f, U&& element,
+                      std::false_type) {
+    fold_update(accumulator, f, std::forward<U>(element),
+                std::is_void<decltype(f(accumulator,
+                                        std::forward<U>(element)))>{});
+}
+
+// Combine 'element' in to 'accumulator' with 'f'. Where 'f' accepts it,
+// the accumulator is moved in to 'f' and replaced by the result, so an 'f'
+// taking it by value or rvalue reference can extend it and return it
+// without copying. Otherwise 'f' takes it by lvalue reference, and may
+// update it in place and return nothing (or a reference to it).
+template <typename T, typename BinaryFunction, typename U>
+void fold_step(T& accumulator, BinaryFunction& f, U&& element) {
+    fold_step_helper(accumulator, f, std::forward<U>(element),
+                     accepts_rvalue<BinaryFunction, T, U&&>{});
+}
+
+// Fold 'f' over [first, last) from the left, starting from 'init'. Unlike
+// std::accumulate before C++20, the accumulator is never copied.
+template <typename Iterator, typename T, typename BinaryFunction>
+T fold_left(Iterator first, Iterator last, T init, BinaryFunction& f) {
+    for (; first != last; ++first) {
+        fold_step(init, f, *first);
+    }
+    return init;
+}
+
+// The total number of elements held by the containers within 'c'
+template <typename Container>
+std::size_t nested_container_size(const Container& c) {
+    std::size_t size = 0;
+    for (const auto& inner : c) {
+        size += container_size(inner);
+    }
+    return size;
+}
+
+template <typename Container, typename... Args>
+auto emplace_back_helper(Container& c, int, Args&&... args)
+    -> decltype(c.emplace_back(std::forward<Args>(args)...), void()) {
+    c.emplace_back(std::forward<Args>(args)...);
+}
+
+template <typename Container, typename... Args>
+void emplace_back_helper(Container& c, long, Args&&... args) {
+    c.emplace(c.end(), std::forward<Args>(args)...);
+}
+
+// Appends elements to the end of a container in constant time. This is how
+// every operation producing a container builds its result, so that they all
+// work with forward_list, which cannot insert before end().
+template <typename Container, typename = void>
+class appender {
+public:
+    explicit appender(Container& c) : container_(c) {}
+
+    // Construct an element from 'args', with emplace_back() if the container
+    // provides it (as it is often cheaper than inserting at end())
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        emplace_back_helper(container_, 0, std::forward<Args>(args)...);
+    }
+
+    template <typename Iterator>
+    void insert(Iterator first, Iterator last) {
+        container_.insert(container_.end(), first, last);
+    }
+
+private:
+    Container& container_;
+};
+
+// forward_list inserts after an iterator, so the last element is tracked.
+// It is found once, when the appender is created.
+template <typename Container>
+class appender<Container,
+               decltype(std::declval<Container&>().before_begin(), void())> {
+public:
+    explicit appender(Container& c) : container_(c), tail_(c.before_begin()) {
+        for (auto it = c.begin(); it != c.end(); ++it) {
+            tail_ = it;
+        }
+    }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        tail_ = container_.emplace_after(tail_, std::forward<Args>(args)...);
+    }
+
+    template <typename Iterator>
+    void insert(Iterator first, Iterator last) {
+        tail_ = container_.insert_after(tail_, first, last);
+    }
+
+private:
+    Container& container_;
+    typename Container::iterator tail_;
+};
+
+template <typename Container>
+appender<Container> make_appender(Container& c) {
+    return appender<Container>(c);
+}
+
+template <typename Container>
+auto erase_from_helper(Container& c, typename Container::iterator first,
+                       std::size_t, int)
+    -> decltype(c.erase(first, c.end()), void()) {
+    c.erase(first, c.end());
+}
+
+template <typename Container>
+void erase_from_helper(Container& c, typename Container::iterator,
+                       std::size_t count, long) {
+    c.erase_after(std::next(c.before_begin(), count), c.end());
+}
+
+// Erase the elements of 'c' from 'first' (which is at index 'count') to the
+// end. forward_list can only erase after an element, so the one before
+// 'first' is found from 'count'.
+template <typename Container>
+void erase_from(Container& c, typename Container::iterator first,
+                std::size_t count) {
+    erase_from_helper(c, first, count, 0);
+}
+
+// Determine whether the elements of an 'Inner' can be spliced in to a
+// 'Container' (i.e., both are lists of the same type)
+template <typename Container, typename Inner>
+auto has_splice_helper(int)
+    -> decltype(std::declval<Container&>().splice(
+                    std::declval<Container&>().end(), std::declval<Inner&>()),
+                std::true_type{});
+
+template <typename Container, typename Inner>
+std::false_type has_splice_helper(long);
+
+template <typename Container, typename Inner>
+using has_splice = decltype(has_splice_helper<Container, Inner>(0));
+
+// Node based containers (list and forward_list) provide member functions for
+// some algorithms, which relink nodes rather than moving elements. The
+// following determine whether 'Container' provides each of them.
+template <typename Container>
+auto has_remove_helper(int)
+    -> decltype(std::declval<Container&>().remove(
+                    std::declval<const typename Container::value_type&>()),
+                std::true_type{});
+
+template <typename Container>
+std::false_type has_remove_helper(long);
+
+template <typename Container>
+using has_remove = decltype(has_remove_helper<Container>(0));
+
+template <typename Container>
+auto has_remove_if_helper(int)
+    -> decltype(std::declval<Container&>().remove_if(
+                    std::declval<bool (*)(
+                        const typename Container::value_type&)>()),
+                std::true_type{});
+
+template <typename Container>
+std::false_type has_remove_if_helper(long);
+
+template <typename Container>
+using has_remove_if = decltype(has_remove_if_helper<Container>(0));
+
+template <typename Container>
+auto has_unique_helper(int)
+    -> decltype(std::declval<Container&>().unique(), std::true_type{});
+
+template <typename Container>
+std::false_type has_unique_helper(long);
+
+template <typename Container>
+using has_unique = decltype(has_unique_helper<Container>(0));
+
+template <typename Container>
+auto has_merge_helper(int)
+    -> decltype(std::declval<Container&>().merge(std::declval<Container&>()),
+                std::true_type{});
+
+template <typename Container>
+std::false_type has_merge_helper(long);
+
+template <typename Container>
+using has_merge = decltype(has_merge_helper<Container>(0));
+
+template <typename Container>
+auto has_reverse_helper(int)
+    -> decltype(std::declval<Container&>().reverse(), std::true_type{});
+
+template <typename Container>
+std::false_type has_reverse_helper(long);
+
+template <typename Container>
+using has_reverse = decltype(has_reverse_helper<Container>(0));
+
+// Determine whether T is a container whose elements flatten_all() should
+// extract. Strings (which have a traits_type) are not, so that they are
+// kept whole rather than flattened to characters.
+template <typename T>
+auto is_flattenable_helper(int)
+    -> decltype(std::declval<const T&>().begin(),
+                std::declval<const T&>().end(),
+                std::declval<typename T::value_type>(),
+                std::integral_constant<bool, true>{});
+
+template <typename T>
+std::false_type is_flattenable_helper(long);
+
+template <typename T>
+auto has_traits_type_helper(int)
+    -> decltype(std::declval<typename T::traits_type>(), std::true_type{});
+
+template <typename T>
+std::false_type has_traits_type_helper(long);
+
+template <typename T>
+using is_flattenable = std::integral_constant<
+    bool, decltype(is_flattenable_helper<T>(0))::value &&
+              !decltype(has_traits_type_helper<T>(0))::value>;
+
+// The innermost of nested containers 'Container' (i.e., the first whose
+// elements are not flattenable, which is Container itself if its own
+// elements are not)
+template <typename Container, typename = void>
+struct innermost_container {
+    using type = Container;
+};
+
+template <typename Container>
+struct innermost_container<
+    Container, typename std::enable_if<
+                   is_flattenable<typename Container::value_type>::value>::type>
+    : innermost_container<typename Container::value_type> {};
+
+template <typename Container>
+std::size_t leaf_count(const Container& c, std::false_type) {
+    return container_size(c);
+}
+
+template <typename Container>
+std::size_t leaf_count(const Container& c, std::true_type) {
+    std::size_t size = 0;
+    for (const auto& inner : c) {
+        using inner_type = typename Container::value_type;
+        size += leaf_count(
+            inner, is_flattenable<typename inner_type::value_type>{});
+    }
+    return size;
+}
+
+// The total number of elements held by the innermost containers of nested
+// containers 'c'
+template <typename Container>
+std::size_t leaf_count(const Container& c) {
+    return leaf_count(c, is_flattenable<typename Container::value_type>{});
+}
+
+// Append the elements of 'c' with 'out' (an appender), moving them if 'c'
+// is an rvalue
+template <typename Appender, typename Container>
+void append_range(Appender& out, Container&& c) {
+    using iterator = decltype(std::begin(c));
+    using source_iterator = typename std::conditional<
+        std::is_lvalue_reference<Container>::value, iterator,
+        std::move_iterator<iterator>>::type;
+    out.insert(source_iterator(std::begin(c)), source_iterator(std::end(c)));
+}
+
+template <typename Appender, typename Container>
+void append_leaves(Appender& out, Container&& c, std::false_type) {
+    append_range(out, std::forward<Container>(c));
+}
+
+template <typename Appender, typename Container>
+void append_leaves(Appender& out, Container&& c, std::true_type) {
+    using inner_type =
+        typename std::remove_reference<Container>::type::value_type;
+    for (auto&& inner : c) {
+        append_leaves(out, forward_like<Container>(inner),
+                      is_flattenable<typename inner_type::value_type>{});
+    }
+}
+
+// Append the elements of the innermost containers of 'c' with 'out', moving
+// them if 'c' is an rvalue
+template <typename Appender, typename Container>
+void append_leaves(Appender& out, Container&& c) {
+    append_leaves(out, std::forward<Container>(c),
+                  is_flattenable<typename std::remove_reference<
+                      Container>::type::value_type>{});
+}
+
 } // end detail
 } // end cec
 
@@ -0,0 +1,193 @@
+#ifndef CEC_FLAT_HASH_SET_DETAIL
+#define CEC_FLAT_HASH_SET_DETAIL
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace cec {
+namespace detail {
+
+// An insert-only open addressing hash set. Elements are stored inline in a
+// single array of slots (so there is no allocation per element), alongside
+// an array with a control byte per slot. A control byte is either empty, or
+// holds the top 7 bits of the hash of the element in its slot, so that
+// most slots holding a different element are skipped without comparing
+// elements. Collisions are resolved by linear probing, and the table is
+// doubled when it becomes 7/8 full.
+template <typename T, typename Hash = std::hash<T>,
+          typename KeyEqual = std::equal_to<T>>
+class flat_hash_set {
+public:
+    // Create a set with room for 'expected' elements before it grows
+    explicit flat_hash_set(std::size_t expected = 0, const Hash& hash = Hash(),
+                           const KeyEqual& equal = KeyEqual())
+        : hash_(hash), equal_(equal), size_(0) {
+        allocate(capacity_for(expected));
+    }
+
+    flat_hash_set(const flat_hash_set&) = delete;
+    flat_hash_set& operator=(const flat_hash_set&) = delete;
+
+    ~flat_hash_set() { destroy(); }
+
+    // Insert 'value' if no equal element is present. Returns whether it was
+    // inserted.
+    bool insert(const T& value) { return insert_helper(value); }
+
+    bool insert(T&& value) { return insert_helper(std::move(value)); }
+
+    bool contains(const T& value) const {
+        std::uint64_t hashed = mix(hash_(value));
+        unsigned char tag = tag_of(hashed);
+        for (std::size_t i = hashed & mask_;; i = (i + 1) & mask_) {
+            if (control_[i] == empty) {
+                return false;
+            }
+            if (control_[i] == tag && equal_(slot(i), value)) {
+                return true;
+            }
+        }
+    }
+
+    std::size_t size() const { return size_; }
+
+private:
+    using storage_type =
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type;
+
+    static constexpr unsigned char empty = 0;
+    static constexpr std::size_t min_capacity = 16;
+
+    // std::hash is the identity for integers on common implementations,
+    // which would make patterns in the elements (e.g., multiples of the
+    // capacity) collide. The hash is mixed so that every bit of it affects
+    // both the starting slot and the tag.
+    static std::uint64_t mix(std::size_t hash) {
+        std::uint64_t mixed = static_cast<std::uint64_t>(hash);
+        mixed ^= mixed >> 33;
+        mixed *= 0xff51afd7ed558ccdULL;
+        mixed ^= mixed >> 33;
+        return mixed;
+    }
+
+    static unsigned char tag_of(std::uint64_t hashed) {
+        return static_cast<unsigned char>(0x80 | (hashed >> 57));
+    }
+
+    // The smallest power of two capacity holding 'size' elements within
+    // the maximum load
+    static std::size_t capacity_for(std::size_t size) {
+        std::size_t capacity = min_capacity;
+        while (capacity / 8 * 7 < size) {
+            capacity *= 2;
+        }
+        return capacity;
+    }
+
+    T& slot(std::size_t i) const {
+        return *reinterpret_cast<T*>(&slots_[i]);
+    }
+
+    template <typename U>
+    bool insert_helper(U&& value) {
+        if (size_ + 1 > (mask_ + 1) / 8 * 7) {
+            grow();
+        }
+        std::uint64_t hashed = mix(hash_(value));
+        unsigned char tag = tag_of(hashed);
+        for (std::size_t i = hashed & mask_;; i = (i + 1) & mask_) {
+            if (control_[i] == empty) {
+                ::new (static_cast<void*>(&slots_[i]))
+                    T(std::forward<U>(value));
+                control_[i] = tag;
+                ++size_;
+                return true;
+            }
+            if (control_[i] == tag && equal_(slot(i), value)) {
+                return false;
+            }
+        }
+    }
+
+    void allocate(std::size_t capacity) {
+        control_.reset(new unsigned char[capacity]());
+        slots_.reset(new storage_type[capacity]);
+        mask_ = capacity - 1;
+    }
+
+    // Elements are moved in to a table of twice the capacity. As they are
+    // known to be distinct, they are placed without comparing them.
+    void grow() {
+        std::unique_ptr<unsigned char[]> old_control(std::move(control_));
+        std::unique_ptr<storage_type[]> old_slots(std::move(slots_));
+        std::size_t old_capacity = mask_ + 1;
+        allocate(old_capacity * 2);
+
+        for (std::size_t i = 0; i < old_capacity; ++i) {
+            if (old_control[i] == empty) {
+                continue;
+            }
+            T& value = *reinterpret_cast<T*>(&old_slots[i]);
+            std::uint64_t hashed = mix(hash_(value));
+            std::size_t j = hashed & mask_;
+            while (control_[j] != empty) {
+                j = (j + 1) & mask_;
+            }
+            ::new (static_cast<void*>(&slots_[j])) T(std::move(value));
+            control_[j] = tag_of(hashed);
+            value.~T();
+        }
+    }
+
+    void destroy() {
+        if (!std::is_trivially_destructible<T>::value) {
+            for (std::size_t i = 0; i <= mask_; ++i) {
+                if (control_[i] != empty) {
+                    slot(i).~T();
+                }
+            }
+        }
+    }
+
+    Hash hash_;
+    KeyEqual equal_;
+    std::size_t size_;
+    std::size_t mask_;
+    std::unique_ptr<unsigned char[]> control_;
+    std::unique_ptr<storage_type[]> slots_;
+};
+
+template <typename T, typename Hash, typename KeyEqual>
+constexpr unsigned char flat_hash_set<T, Hash, KeyEqual>::empty;
+
+template <typename T, typename Hash, typename KeyEqual>
+constexpr std::size_t flat_hash_set<T, Hash, KeyEqual>::min_capacity;
+
+// Hashes and compares pointers by the values they point to, so that a set
+// of pointers to the elements of a container can stand in for a set of
+// copies of them
+template <typename T, typename Hash = std::hash<T>>
+struct indirect_hash {
+    std::size_t operator()(const T* value) const { return Hash()(*value); }
+};
+
+template <typename T, typename KeyEqual = std::equal_to<T>>
+struct indirect_equal {
+    bool operator()(const T* a, const T* b) const {
+        return KeyEqual()(*a, *b);
+    }
+};
+
+template <typename T>
+using indirect_hash_set =
+    flat_hash_set<const T*, indirect_hash<T>, indirect_equal<T>>;
+
+} // end detail
+} // end cec
+
+#endif
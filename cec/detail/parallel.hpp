@@ -0,0 +1,272 @@
+#ifndef CEC_PARALLEL_DETAIL
+#define CEC_PARALLEL_DETAIL
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include <cec/execution.hpp>
+#include <cec/detail/extended_sequence_container.hpp>
+#include <cec/detail/view.hpp>
+
+namespace cec {
+namespace detail {
+
+// Whether 'Policy' permits running on more than one thread
+template <typename Policy>
+struct is_parallel_policy
+    : std::integral_constant<
+          bool,
+          std::is_same<Policy, execution::parallel_policy>::value ||
+              std::is_same<Policy,
+                           execution::parallel_unsequenced_policy>::value> {};
+
+// Only random access containers can be cheaply split in to chunks, so
+// other containers are always processed serially
+template <typename Policy, typename Container>
+using use_parallel = std::integral_constant<
+    bool, is_parallel_policy<typename std::decay<Policy>::type>::value &&
+              is_random_access<Container>::value>;
+
+// 'T' if 'Policy' is an execution policy, otherwise a substitution failure.
+// Used to keep the policy overloads from competing with e.g., reduce(f, init)
+template <typename Policy, typename T>
+using enable_if_execution_policy = typename std::enable_if<
+    is_execution_policy<typename std::decay<Policy>::type>::value, T>::type;
+
+// 'T' if 'Function' is not an execution policy
+template <typename Function, typename T>
+using enable_if_not_execution_policy = typename std::enable_if<
+    !is_execution_policy<typename std::decay<Function>::type>::value, T>::type;
+
+// A fixed set of worker threads shared by all parallel operations
+class thread_pool {
+public:
+    explicit thread_pool(std::size_t threads) : stopping_(false) {
+        for (std::size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    ~thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    thread_pool(const thread_pool&) = delete;
+    thread_pool& operator=(const thread_pool&) = delete;
+
+    // The calling thread always participates in parallel operations, so
+    // one fewer worker than there are hardware threads is needed.
+    static thread_pool& instance() {
+        static thread_pool pool(
+            std::max(std::thread::hardware_concurrency(), 2u) - 1);
+        return pool;
+    }
+
+    std::size_t size() const { return workers_.size(); }
+
+    void submit(std::function<void()> task) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.push(std::move(task));
+        }
+        wake_.notify_one();
+    }
+
+private:
+    void run() {
+        for (;;) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_.wait(lock,
+                           [this] { return stopping_ || !tasks_.empty(); });
+                if (tasks_.empty()) {
+                    return;
+                }
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+            task();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::queue<std::function<void()>> tasks_;
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    bool stopping_;
+};
+
+// The shared state of a single call to parallel_for. Chunks are claimed
+// through an atomic counter by the calling thread and by any pool workers
+// which pick up the job, so the caller never waits on a busy pool.
+class parallel_job {
+public:
+    parallel_job(std::size_t count, std::function<void(std::size_t)> body)
+        : count_(count), next_(0), failed_(false), finished_(0),
+          body_(std::move(body)) {}
+
+    // Run chunks until none remain unclaimed
+    void work() {
+        std::size_t ran = 0;
+        for (std::size_t i = next_++; i < count_; i = next_++, ++ran) {
+            if (failed_) {
+                continue;
+            }
+            try {
+                body_(i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) {
+                    error_ = std::current_exception();
+                }
+                failed_ = true;
+            }
+        }
+
+        if (ran != 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            finished_ += ran;
+            if (finished_ == count_) {
+                done_.notify_all();
+            }
+        }
+    }
+
+    // Wait for every chunk to finish, rethrowing the first exception thrown
+    // by any of them
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_.wait(lock, [this] { return finished_ == count_; });
+        if (error_) {
+            std::rethrow_exception(error_);
+        }
+    }
+
+private:
+    const std::size_t count_;
+    std::atomic<std::size_t> next_;
+    std::atomic<bool> failed_;
+    std::size_t finished_;
+    std::exception_ptr error_;
+    std::mutex mutex_;
+    std::condition_variable done_;
+    std::function<void(std::size_t)> body_;
+};
+
+// The smallest number of elements worth handing to another thread
+constexpr std::size_t parallel_grain_size = 2048;
+
+// The number of chunks to split 'size' elements in to. A few chunks per
+// thread are used so that uneven work is balanced between threads.
+inline std::size_t parallel_chunk_count(std::size_t size) {
+    std::size_t by_grain =
+        (size + parallel_grain_size - 1) / parallel_grain_size;
+    std::size_t by_threads = (thread_pool::instance().size() + 1) * 4;
+    return std::max<std::size_t>(1, std::min(by_grain, by_threads));
+}
+
+// The index of the first element of chunk 'i' of 'count' chunks
+inline std::size_t chunk_begin(std::size_t size, std::size_t count,
+                               std::size_t i) {
+    return size / count * i + std::min(i, size % count);
+}
+
+// Invoke body(i) for each i in [0, count), distributing calls across the
+// thread pool
+template <typename Function>
+void parallel_for(std::size_t count, Function body) {
+    if (count == 0) {
+        return;
+    } else if (count == 1) {
+        body(0);
+        return;
+    }
+
+    auto job = std::make_shared<parallel_job>(count, std::ref(body));
+    auto helpers = std::min(thread_pool::instance().size(), count - 1);
+    for (std::size_t i = 0; i < helpers; ++i) {
+        thread_pool::instance().submit([job] { job->work(); });
+    }
+    job->work();
+    job->wait();
+}
+
+// Split [0, size) in to 'count' chunks, and invoke body(chunk, first, last)
+// for each chunk in parallel
+template <typename Function>
+void parallel_for_chunks(std::size_t size, std::size_t count, Function body) {
+    parallel_for(count, [&](std::size_t i) {
+        body(i, chunk_begin(size, count, i), chunk_begin(size, count, i + 1));
+    });
+}
+
+// The number of elements folded serially at each leaf of a tree reduction.
+// This is a constant, rather than being derived from the number of threads,
+// so that the shape of the tree (and therefore the result of e.g., a floating
+// point sum) is the same on every machine.
+constexpr std::size_t reduce_leaf_size = 4096;
+
+// Reduce the 'size' elements starting at 'first' by computing leaf(first,
+// last) for consecutive ranges of reduce_leaf_size elements, then combining
+// the leaf results pairwise: ((l0, l1), (l2, l3)), ... The leaves are
+// computed on the thread pool if 'parallel' is true, but the result does
+// not depend on it. 'size' must not be zero.
+template <typename T, typename Iterator, typename Leaf, typename Combine>
+T tree_reduce(Iterator first, std::size_t size, Leaf leaf, Combine& combine,
+              bool parallel) {
+    std::size_t leaves = (size + reduce_leaf_size - 1) / reduce_leaf_size;
+
+    // Finding leaf boundaries up front means the leaves can be computed
+    // independently even when Iterator is not random access
+    std::vector<Iterator> bounds;
+    bounds.reserve(leaves + 1);
+    bounds.push_back(first);
+    for (std::size_t i = 1; i < leaves; ++i) {
+        bounds.push_back(std::next(bounds.back(), reduce_leaf_size));
+    }
+    bounds.push_back(std::next(bounds.back(),
+                               size - (leaves - 1) * reduce_leaf_size));
+
+    std::vector<box<T>> partials(leaves);
+    auto compute_leaf = [&](std::size_t i) {
+        partials[i].emplace(leaf(bounds[i], bounds[i + 1]));
+    };
+    if (parallel) {
+        parallel_for(leaves, compute_leaf);
+    } else {
+        for (std::size_t i = 0; i < leaves; ++i) {
+            compute_leaf(i);
+        }
+    }
+
+    for (std::size_t width = 1; width < leaves; width *= 2) {
+        for (std::size_t i = 0; i + width < leaves; i += 2 * width) {
+            T combined =
+                combine(std::move(*partials[i]), std::move(*partials[i + width]));
+            partials[i].emplace(std::move(combined));
+        }
+    }
+    return std::move(*partials[0]);
+}
+
+} // end detail
+} // end cec
+
+#endif
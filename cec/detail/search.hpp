@@ -0,0 +1,364 @@
+#ifndef CEC_SEARCH_DETAIL
+#define CEC_SEARCH_DETAIL
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <cec/detail/config.hpp>
+#include <cec/detail/cpu.hpp>
+
+#ifdef CEC_HAS_STRING_VIEW
+#include <string_view>
+#endif
+
+namespace cec {
+namespace detail {
+
+// Kernels for finding and counting the elements of a contiguous range equal
+// to a value, for element types compared by value (integers and floating
+// point numbers). Each AVX2 step compares 32 bytes of elements at once and
+// reduces the comparison to a bit mask, with one or more bits per element.
+
+// Identifies how elements of type T are compared: by their size for
+// integers (whose equality is bitwise), and by negated size for floating
+// point numbers (whose equality is not, e.g., for -0.0 and NaN). Any other
+// kind is left to the scalar kernels.
+template <typename T>
+using compare_kind = std::integral_constant<
+    int, std::is_floating_point<T>::value ? -static_cast<int>(sizeof(T))
+                                          : static_cast<int>(sizeof(T))>;
+
+// Whether the elements of a T can be compared with the vector kernels
+template <typename T>
+using is_trivially_comparable =
+    std::integral_constant<bool, std::is_arithmetic<T>::value &&
+                                     sizeof(T) <= 8>;
+
+template <typename T>
+std::size_t count_value_scalar(const T* data, std::size_t size,
+                               const T& value) {
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+        count += data[i] == value;
+    }
+    return count;
+}
+
+#ifdef CEC_X86_DISPATCH
+template <typename T>
+CEC_TARGET("avx2")
+unsigned equal_mask_avx2(const T* data, T value,
+                         std::integral_constant<int, 1>) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi8(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+        _mm256_set1_epi8(static_cast<char>(value))));
+}
+
+template <typename T>
+CEC_TARGET("avx2")
+unsigned equal_mask_avx2(const T* data, T value,
+                         std::integral_constant<int, 2>) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi16(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+        _mm256_set1_epi16(static_cast<short>(value))));
+}
+
+template <typename T>
+CEC_TARGET("avx2")
+unsigned equal_mask_avx2(const T* data, T value,
+                         std::integral_constant<int, 4>) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi32(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+        _mm256_set1_epi32(static_cast<int>(value))));
+}
+
+template <typename T>
+CEC_TARGET("avx2")
+unsigned equal_mask_avx2(const T* data, T value,
+                         std::integral_constant<int, 8>) {
+    return _mm256_movemask_epi8(_mm256_cmpeq_epi64(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data)),
+        _mm256_set1_epi64x(static_cast<long long>(value))));
+}
+
+CEC_TARGET("avx2")
+inline unsigned equal_mask_avx2(const float* data, float value,
+                                std::integral_constant<int, -4>) {
+    return _mm256_movemask_ps(_mm256_cmp_ps(
+        _mm256_loadu_ps(data), _mm256_set1_ps(value), _CMP_EQ_OQ));
+}
+
+CEC_TARGET("avx2")
+inline unsigned equal_mask_avx2(const double* data, double value,
+                                std::integral_constant<int, -8>) {
+    return _mm256_movemask_pd(_mm256_cmp_pd(
+        _mm256_loadu_pd(data), _mm256_set1_pd(value), _CMP_EQ_OQ));
+}
+
+// The number of mask bits per element
+template <int Kind>
+constexpr unsigned mask_bits(std::integral_constant<int, Kind>) {
+    return Kind > 0 ? Kind : 1;
+}
+
+template <typename T, int Kind>
+CEC_TARGET("avx2")
+std::size_t count_value_avx2(const T* data, std::size_t size, T value,
+                             std::integral_constant<int, Kind> kind) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    std::size_t bits = 0;
+    std::size_t i = 0;
+    for (; i + lanes <= size; i += lanes) {
+        bits += __builtin_popcount(equal_mask_avx2(data + i, value, kind));
+    }
+    return bits / mask_bits(kind) +
+           count_value_scalar(data + i, size - i, value);
+}
+
+template <typename T, int Kind>
+CEC_TARGET("avx2")
+const T* find_value_avx2(const T* first, const T* last, T value,
+                         std::integral_constant<int, Kind> kind) {
+    constexpr std::size_t lanes = 32 / sizeof(T);
+    for (; static_cast<std::size_t>(last - first) >= lanes; first += lanes) {
+        unsigned mask = equal_mask_avx2(first, value, kind);
+        if (mask != 0) {
+            return first + __builtin_ctz(mask) / mask_bits(kind);
+        }
+    }
+    return std::find(first, last, value);
+}
+
+template <typename T, int Kind>
+std::size_t count_value_dispatch(const T* data, std::size_t size,
+                                 const T& value,
+                                 std::integral_constant<int, Kind> kind) {
+    if (cpu_has_avx2()) {
+        return count_value_avx2(data, size, value, kind);
+    }
+    return count_value_scalar(data, size, value);
+}
+
+template <typename T, int Kind>
+const T* find_value_dispatch(const T* first, const T* last, const T& value,
+                             std::integral_constant<int, Kind> kind) {
+    if (cpu_has_avx2()) {
+        return find_value_avx2(first, last, value, kind);
+    }
+    return std::find(first, last, value);
+}
+#else
+template <typename T, int Kind>
+const T* find_value_dispatch(const T* first, const T* last, const T& value,
+                             std::integral_constant<int, Kind>) {
+    return std::find(first, last, value);
+}
+#endif
+
+// Single bytes are found with memchr, which the C library implements with
+// the best instructions available. The data of an empty container may be
+// null, which memchr must not be given.
+template <typename T>
+const T* find_value_dispatch(const T* first, const T* last, const T& value,
+                             std::integral_constant<int, 1>) {
+    if (first == last) {
+        return last;
+    }
+    auto found = std::memchr(first, static_cast<unsigned char>(value),
+                             static_cast<std::size_t>(last - first));
+    return found ? static_cast<const T*>(found) : last;
+}
+
+// Count the elements of [data, data + size) equal to value
+template <typename T>
+std::size_t count_value(const T* data, std::size_t size, const T& value) {
+#ifdef CEC_X86_DISPATCH
+    return count_value_dispatch(data, size, value, compare_kind<T>{});
+#else
+    return count_value_scalar(data, size, value);
+#endif
+}
+
+// Find the first element of [first, last) equal to value, or last
+template <typename T>
+const T* find_value(const T* first, const T* last, const T& value) {
+    return find_value_dispatch(first, last, value, compare_kind<T>{});
+}
+
+// Count the elements of [data, data + size) satisfying p. Adding the
+// result of the predicate rather than branching on it, over blocks of a
+// fixed size, allows compilers to vectorize simple predicates (e.g.,
+// comparisons).
+constexpr std::size_t count_block_size = 64;
+
+template <typename T, typename Predicate>
+std::size_t count_if_contiguous(const T* data, std::size_t size,
+                                Predicate& p) {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    for (; i + count_block_size <= size; i += count_block_size) {
+        unsigned block = 0;
+        for (std::size_t lane = 0; lane < count_block_size; ++lane) {
+            block += static_cast<bool>(p(data[i + lane]));
+        }
+        count += block;
+    }
+    for (; i < size; ++i) {
+        count += static_cast<bool>(p(data[i]));
+    }
+    return count;
+}
+
+// Whether 'Container' stores trivially comparable elements contiguously
+template <typename Container>
+auto is_searchable_helper(int) -> std::integral_constant<
+    bool, is_trivially_comparable<typename Container::value_type>::value &&
+              std::is_same<decltype(std::declval<const Container&>().data()),
+                           const typename Container::value_type*>::value>;
+
+template <typename Container>
+std::false_type is_searchable_helper(long);
+
+template <typename Container>
+using is_searchable = decltype(is_searchable_helper<Container>(0));
+
+// The characters of a needle for a substring search
+inline std::pair<const char*, std::size_t> char_range(const char* s) {
+    return {s, std::strlen(s)};
+}
+
+template <typename Allocator>
+std::pair<const char*, std::size_t> char_range(
+    const std::basic_string<char, std::char_traits<char>, Allocator>& s) {
+    return {s.data(), s.size()};
+}
+
+#ifdef CEC_HAS_STRING_VIEW
+inline std::pair<const char*, std::size_t> char_range(std::string_view s) {
+    return {s.data(), s.size()};
+}
+#endif
+
+inline const char* find_substring_scalar(const char* first, const char* last,
+                                         const char* needle,
+                                         std::size_t needle_size) {
+    return std::search(first, last, needle, needle + needle_size);
+}
+
+#ifdef CEC_X86_DISPATCH
+// Compare the first and last characters of the needle with 32 candidate
+// positions at once, and only compare the rest of the needle at positions
+// where both match. Only the candidate positions [first, last) are checked.
+CEC_TARGET("avx2")
+inline const char* find_substring_avx2(const char* first, const char* last,
+                                       const char* needle,
+                                       std::size_t needle_size) {
+    const __m256i head = _mm256_set1_epi8(needle[0]);
+    const __m256i tail = _mm256_set1_epi8(needle[needle_size - 1]);
+
+    for (; last - first >= 32; first += 32) {
+        __m256i heads =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+        __m256i tails = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(first + needle_size - 1));
+        unsigned mask = _mm256_movemask_epi8(
+            _mm256_and_si256(_mm256_cmpeq_epi8(heads, head),
+                             _mm256_cmpeq_epi8(tails, tail)));
+        while (mask != 0) {
+            auto candidate = first + __builtin_ctz(mask);
+            if (std::memcmp(candidate + 1, needle + 1, needle_size - 2) == 0) {
+                return candidate;
+            }
+            mask &= mask - 1;
+        }
+    }
+    for (; first != last; ++first) {
+        if (std::memcmp(first, needle, needle_size) == 0) {
+            return first;
+        }
+    }
+    return nullptr;
+}
+#endif
+
+// Whether [data, data + size) contains the substring [needle, needle +
+// needle_size)
+inline bool contains_substring(const char* data, std::size_t size,
+                               const char* needle, std::size_t needle_size) {
+    if (needle_size == 0) {
+        return true;
+    }
+    if (needle_size > size) {
+        return false;
+    }
+#ifdef CEC_X86_DISPATCH
+    if (needle_size >= 2 && cpu_has_avx2()) {
+        return find_substring_avx2(data, data + size - needle_size + 1, needle,
+                                   needle_size) != nullptr;
+    }
+#endif
+    return find_substring_scalar(data, data + size, needle, needle_size) !=
+           data + size;
+}
+
+// Whether 'String' contains 'needle'. Strings of char are searched with
+// the vector kernel when the needle is a string of char, and any others
+// with their own find().
+template <typename String, typename T>
+auto contains_substring(const String& s, const T& needle, int)
+    -> typename std::enable_if<
+        std::is_same<typename String::traits_type,
+                     std::char_traits<char>>::value,
+        decltype(char_range(needle), bool())>::type {
+    auto range = char_range(needle);
+    return contains_substring(s.data(), s.size(), range.first, range.second);
+}
+
+template <typename String, typename T>
+bool contains_substring(const String& s, const T& needle, long) {
+    return s.find(needle) != String::npos;
+}
+
+// How a container is searched for a value of type T: element by element,
+// with the vector kernels, or as a substring
+struct search_elements {};
+struct search_values {};
+struct search_substring {};
+
+// Whether 'Container' has a find() for a T which is not one of its elements
+// (i.e., a substring search)
+template <typename Container, typename T>
+auto has_substring_find_helper(int) -> std::integral_constant<
+    bool,
+    !std::is_convertible<const T&, typename Container::value_type>::value &&
+        std::is_same<decltype(std::declval<const Container&>().find(
+                         std::declval<const T&>())),
+                     typename Container::size_type>::value>;
+
+template <typename Container, typename T>
+std::false_type has_substring_find_helper(long);
+
+template <typename Container, typename T>
+using has_substring_find =
+    decltype(has_substring_find_helper<Container, T>(0));
+
+// Values are searched for with the vector kernels when both they and the
+// elements are integers, or they are the same type
+template <typename Container, typename T>
+using search_strategy = typename std::conditional<
+    is_searchable<Container>::value &&
+        (std::is_same<T, typename Container::value_type>::value ||
+         (std::is_integral<T>::value &&
+          std::is_integral<typename Container::value_type>::value)),
+    search_values,
+    typename std::conditional<has_substring_find<Container, T>::value,
+                              search_substring,
+                              search_elements>::type>::type;
+
+} // end detail
+} // end cec
+
+#endif
@@ -0,0 +1,348 @@
+#ifndef CEC_SORT_DETAIL
+#define CEC_SORT_DETAIL
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cec/detail/parallel.hpp>
+
+namespace cec {
+namespace detail {
+
+// Map an arithmetic value to an unsigned integer with the same ordering, so
+// that it can be radix sorted
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, T>::type
+to_radix_key(T value) {
+    return value;
+}
+
+// Flipping the sign bit orders negative values before positive ones
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value,
+                        typename std::make_unsigned<T>::type>::type
+to_radix_key(T value) {
+    using key_type = typename std::make_unsigned<T>::type;
+    return static_cast<key_type>(
+        static_cast<key_type>(value) ^
+        static_cast<key_type>(key_type(1) << (sizeof(T) * 8 - 1)));
+}
+
+// For IEEE floating point values, the sign bit is flipped for positive
+// values, and every bit is flipped for negative values (whose magnitude
+// ordering is reversed). -0.0 compares equal to +0.0, so it is given the
+// same key, keeping the two in their original order in a stable sort.
+inline std::uint32_t to_radix_key(float value) {
+    if (value == 0.0f) {
+        value = 0.0f;
+    }
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+inline std::uint64_t to_radix_key(double value) {
+    if (value == 0.0) {
+        value = 0.0;
+    }
+    std::uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return (bits & 0x8000000000000000u) ? ~bits : (bits | 0x8000000000000000u);
+}
+
+// Whether values of type T can be radix sorted
+template <typename T>
+struct is_radix_key
+    : std::integral_constant<
+          bool, (std::is_integral<T>::value && !std::is_same<T, bool>::value) ||
+                    ((std::is_same<T, float>::value ||
+                      std::is_same<T, double>::value) &&
+                     std::numeric_limits<T>::is_iec559)> {};
+
+// Whether sorting values of type T with Compare is equivalent to radix
+// sorting them (in ascending or descending order)
+template <typename T, typename Compare>
+struct is_radix_sortable : std::false_type {};
+
+template <typename T>
+struct is_radix_sortable<T, std::less<T>> : is_radix_key<T> {};
+
+template <typename T>
+struct is_radix_sortable<T, std::greater<T>> : is_radix_key<T> {};
+
+#if __cplusplus >= 201402L
+template <typename T>
+struct is_radix_sortable<T, std::less<>> : is_radix_key<T> {};
+
+template <typename T>
+struct is_radix_sortable<T, std::greater<>> : is_radix_key<T> {};
+#endif
+
+// Whether Compare is one of the std::greater comparators
+template <typename Compare>
+struct is_descending : std::false_type {};
+
+template <typename T>
+struct is_descending<std::greater<T>> : std::true_type {};
+
+// Produces the radix key of a value, inverted if sorting in descending order
+template <typename T, bool Descending>
+struct radix_key_function {
+    auto operator()(T value) const -> decltype(to_radix_key(value)) {
+        using key_type = decltype(to_radix_key(value));
+        return Descending ? static_cast<key_type>(~to_radix_key(value))
+                          : to_radix_key(value);
+    }
+};
+
+// Below this many elements, comparison sorting is faster than radix sorting
+constexpr std::size_t radix_sort_threshold = 1024;
+
+// Move each element of [first, last) to its place in 'out' according to the
+// byte of its key at 'shift'
+template <typename InputIterator, typename OutputIterator,
+          typename KeyFunction>
+void radix_scatter(InputIterator first, InputIterator last, OutputIterator out,
+                   std::array<std::size_t, 256>& offsets, std::size_t shift,
+                   KeyFunction& key_of) {
+    for (; first != last; ++first) {
+        auto digit = (key_of(*first) >> shift) & 0xff;
+        out[offsets[digit]++] = std::move(*first);
+    }
+}
+
+// Stable least significant digit radix sort of [first, last) by the unsigned
+// integer key_of(element), one byte per pass. Passes in which every key has
+// the same byte are skipped.
+template <typename RandomAccessIterator, typename KeyFunction>
+void radix_sort(RandomAccessIterator first, RandomAccessIterator last,
+                KeyFunction key_of) {
+    using value_type =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using key_type = decltype(key_of(*first));
+    constexpr std::size_t passes = sizeof(key_type);
+
+    std::size_t size = std::distance(first, last);
+    if (size < 2) {
+        return;
+    }
+
+    // Histograms for every pass are built in a single read of the input
+    std::vector<std::array<std::size_t, 256>> counts(passes);
+    for (auto iter = first; iter != last; ++iter) {
+        key_type key = key_of(*iter);
+        for (std::size_t pass = 0; pass < passes; ++pass) {
+            ++counts[pass][(key >> (pass * 8)) & 0xff];
+        }
+    }
+
+    std::vector<value_type> buffer(size);
+    bool in_buffer = false;
+    for (std::size_t pass = 0; pass < passes; ++pass) {
+        auto& offsets = counts[pass];
+        std::size_t shift = pass * 8;
+
+        key_type sample = in_buffer ? key_of(buffer.front()) : key_of(*first);
+        if (offsets[(sample >> shift) & 0xff] == size) {
+            continue;
+        }
+
+        std::size_t total = 0;
+        for (auto& offset : offsets) {
+            std::size_t count = offset;
+            offset = total;
+            total += count;
+        }
+
+        if (in_buffer) {
+            radix_scatter(buffer.begin(), buffer.end(), first, offsets, shift,
+                          key_of);
+        } else {
+            radix_scatter(first, last, buffer.begin(), offsets, shift, key_of);
+        }
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer) {
+        std::move(buffer.begin(), buffer.end(), first);
+    }
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void sort_dispatch(RandomAccessIterator first, RandomAccessIterator last,
+                   Compare& comp, std::true_type) {
+    using value_type =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if (static_cast<std::size_t>(std::distance(first, last)) <
+        radix_sort_threshold) {
+        std::sort(first, last, comp);
+    } else {
+        radix_sort(first, last,
+                   radix_key_function<value_type,
+                                      is_descending<Compare>::value>{});
+    }
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void sort_dispatch(RandomAccessIterator first, RandomAccessIterator last,
+                   Compare& comp, std::false_type) {
+    std::sort(first, last, comp);
+}
+
+// Sorts a range with std::sort, or with a radix sort when that is
+// equivalent
+struct unstable_sorter {
+    template <typename RandomAccessIterator, typename Compare>
+    void operator()(RandomAccessIterator first, RandomAccessIterator last,
+                    Compare& comp) const {
+        sort_dispatch(
+            first, last, comp,
+            is_radix_sortable<typename std::iterator_traits<
+                                  RandomAccessIterator>::value_type,
+                              Compare>{});
+    }
+};
+
+// The radix sort is stable, but small ranges must also be sorted stably, as
+// equivalent values (e.g., -0.0 and +0.0) may still be distinguished
+template <typename RandomAccessIterator, typename Compare>
+void stable_sort_dispatch(RandomAccessIterator first,
+                          RandomAccessIterator last, Compare& comp,
+                          std::true_type) {
+    using value_type =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    if (static_cast<std::size_t>(std::distance(first, last)) <
+        radix_sort_threshold) {
+        std::stable_sort(first, last, comp);
+    } else {
+        radix_sort(first, last,
+                   radix_key_function<value_type,
+                                      is_descending<Compare>::value>{});
+    }
+}
+
+template <typename RandomAccessIterator, typename Compare>
+void stable_sort_dispatch(RandomAccessIterator first,
+                          RandomAccessIterator last, Compare& comp,
+                          std::false_type) {
+    std::stable_sort(first, last, comp);
+}
+
+// Sorts a range with std::stable_sort, or with a radix sort when that is
+// equivalent
+struct stable_sorter {
+    template <typename RandomAccessIterator, typename Compare>
+    void operator()(RandomAccessIterator first, RandomAccessIterator last,
+                    Compare& comp) const {
+        stable_sort_dispatch(
+            first, last, comp,
+            is_radix_sortable<typename std::iterator_traits<
+                                  RandomAccessIterator>::value_type,
+                              Compare>{});
+    }
+};
+
+// Stably sort [first, last) by key(element), where the key is an arithmetic
+// type. The keys are computed once, radix sorted along with the original
+// index of each element, and the elements are then moved in to place.
+template <typename RandomAccessIterator, typename KeyFunction>
+void radix_sort_by(RandomAccessIterator first, RandomAccessIterator last,
+                   KeyFunction& key) {
+    using value_type =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    using key_type = decltype(to_radix_key(key(*first)));
+    using item = std::pair<key_type, std::size_t>;
+
+    std::size_t size = std::distance(first, last);
+    std::vector<item> items;
+    items.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        items.emplace_back(to_radix_key(key(first[i])), i);
+    }
+
+    radix_sort(items.begin(), items.end(),
+               [](const item& i) { return i.first; });
+
+    std::vector<value_type> sorted;
+    sorted.reserve(size);
+    for (const auto& i : items) {
+        sorted.push_back(std::move(first[i.second]));
+    }
+    std::move(sorted.begin(), sorted.end(), first);
+}
+
+template <typename RandomAccessIterator, typename KeyFunction>
+void sort_by_dispatch(RandomAccessIterator first, RandomAccessIterator last,
+                      KeyFunction& key, std::false_type) {
+    using value_type =
+        typename std::iterator_traits<RandomAccessIterator>::value_type;
+    std::stable_sort(first, last,
+                     [&key](const value_type& lhs, const value_type& rhs) {
+                         return key(lhs) < key(rhs);
+                     });
+}
+
+template <typename RandomAccessIterator, typename KeyFunction>
+void sort_by_dispatch(RandomAccessIterator first, RandomAccessIterator last,
+                      KeyFunction& key, std::true_type) {
+    if (static_cast<std::size_t>(std::distance(first, last)) <
+        radix_sort_threshold) {
+        sort_by_dispatch(first, last, key, std::false_type{});
+    } else {
+        radix_sort_by(first, last, key);
+    }
+}
+
+// Below this many elements, a parallel sort is performed serially as the
+// cost of coordinating threads outweighs the benefit
+constexpr std::size_t parallel_sort_threshold = 1 << 15;
+
+// Sort [first, last) by sorting chunks on the thread pool with a Sorter
+// and then merging adjacent pairs of chunks, again in parallel, until a
+// single sorted range remains. The merge is stable, so the sort is stable
+// if the Sorter is.
+template <typename RandomAccessIterator, typename Compare, typename Sorter>
+void parallel_merge_sort(RandomAccessIterator first, RandomAccessIterator last,
+                         Compare& comp, Sorter sorter) {
+    std::size_t size = std::distance(first, last);
+    if (size < parallel_sort_threshold) {
+        sorter(first, last, comp);
+        return;
+    }
+
+    // A power of two number of chunks lets every merge pass pair them evenly
+    std::size_t threads = thread_pool::instance().size() + 1;
+    std::size_t chunks = 1;
+    while (chunks < threads && size / (chunks * 2) >= parallel_grain_size) {
+        chunks *= 2;
+    }
+
+    auto bound = [&](std::size_t chunk) {
+        return std::next(first, chunk_begin(size, chunks, chunk));
+    };
+
+    parallel_for(chunks, [&](std::size_t chunk) {
+        sorter(bound(chunk), bound(chunk + 1), comp);
+    });
+
+    for (std::size_t width = 1; width < chunks; width *= 2) {
+        parallel_for(chunks / (2 * width), [&](std::size_t pair) {
+            std::size_t lower = pair * 2 * width;
+            std::inplace_merge(bound(lower), bound(lower + width),
+                               bound(lower + 2 * width), comp);
+        });
+    }
+}
+
+} // end detail
+} // end cec
+
+#endif
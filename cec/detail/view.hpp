@@ -0,0 +1,572 @@
+#ifndef CEC_VIEW_DETAIL
+#define CEC_VIEW_DETAIL
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cec/detail/extended_sequence_container.hpp>
+
+namespace cec {
+namespace detail {
+
+// Minimal optional-like storage. Lambdas are copy constructible but not
+// copy assignable, which iterators must be, so function objects held by
+// the view iterators are stored in a box that implements assignment by
+// re-constructing the held value.
+template <typename T>
+class box {
+public:
+    box() : engaged_(false) {}
+
+    explicit box(const T& value) : engaged_(false) { emplace(value); }
+
+    box(const box& other) : engaged_(false) {
+        if (other.engaged_) {
+            emplace(*other);
+        }
+    }
+
+    box& operator=(const box& other) {
+        if (this != &other) {
+            if (other.engaged_) {
+                T copy(*other);
+                emplace(std::move(copy));
+            } else {
+                reset();
+            }
+        }
+        return *this;
+    }
+
+    ~box() { reset(); }
+
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        reset();
+        ::new (address()) T(std::forward<Args>(args)...);
+        engaged_ = true;
+    }
+
+    void reset() {
+        if (engaged_) {
+            (**this).~T();
+            engaged_ = false;
+        }
+    }
+
+    // The boxed value is logically part of the iterator state, but
+    // function objects may have a non-const call operator, so access is
+    // always mutable.
+    T& operator*() const { return *static_cast<T*>(address()); }
+
+private:
+    void* address() const {
+        return const_cast<void*>(static_cast<const void*>(&storage_));
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type storage_;
+    bool engaged_;
+};
+
+// Stages which inspect an element before yielding it (filter and
+// take_while) would evaluate every upstream map function twice per element.
+// If the underlying iterator yields by value, the cursor caches the value
+// so it is only produced once.
+template <typename Iterator,
+          bool = std::is_reference<
+              typename std::iterator_traits<Iterator>::reference>::value>
+struct cursor {
+    using reference = typename std::iterator_traits<Iterator>::reference;
+
+    explicit cursor(Iterator iter) : iter(iter) {}
+
+    void load() {}
+    reference get() const { return *iter; }
+
+    Iterator iter;
+};
+
+template <typename Iterator>
+struct cursor<Iterator, false> {
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = const value_type&;
+
+    explicit cursor(Iterator iter) : iter(iter) {}
+
+    void load() { cache.emplace(*iter); }
+    reference get() const { return *cache; }
+
+    Iterator iter;
+    box<value_type> cache;
+};
+
+// CRTP base providing the boilerplate common to the view iterators.
+// Derived must provide dereference(), increment() and equal().
+template <typename Derived, typename Value, typename Reference,
+          typename Difference>
+class view_iterator_base {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = Value;
+    using reference = Reference;
+    using difference_type = Difference;
+    using pointer = void;
+
+    reference operator*() const { return derived().dereference(); }
+
+    Derived& operator++() {
+        derived().increment();
+        return derived();
+    }
+
+    Derived operator++(int) {
+        Derived copy = derived();
+        derived().increment();
+        return copy;
+    }
+
+    friend bool operator==(const Derived& lhs, const Derived& rhs) {
+        return equal(lhs, rhs);
+    }
+
+    friend bool operator!=(const Derived& lhs, const Derived& rhs) {
+        return !equal(lhs, rhs);
+    }
+
+private:
+    static bool equal(const Derived& lhs, const Derived& rhs) {
+        return lhs.equal(rhs);
+    }
+
+    Derived& derived() { return static_cast<Derived&>(*this); }
+    const Derived& derived() const {
+        return static_cast<const Derived&>(*this);
+    }
+};
+
+template <typename Iterator>
+using iterator_difference_t =
+    typename std::iterator_traits<Iterator>::difference_type;
+
+template <typename Iterator, typename Function>
+using map_result_t =
+    decltype(std::declval<Function&>()(*std::declval<Iterator>()));
+
+// Yields f(*iter) for each element of the underlying range
+template <typename Iterator, typename Function>
+class map_iterator
+    : public view_iterator_base<
+          map_iterator<Iterator, Function>,
+          typename std::decay<map_result_t<Iterator, Function>>::type,
+          map_result_t<Iterator, Function>, iterator_difference_t<Iterator>> {
+    friend class view_iterator_base<
+        map_iterator,
+        typename std::decay<map_result_t<Iterator, Function>>::type,
+        map_result_t<Iterator, Function>, iterator_difference_t<Iterator>>;
+
+public:
+    map_iterator(Iterator iter, const Function& f) : iter_(iter), f_(f) {}
+
+private:
+    map_result_t<Iterator, Function> dereference() const {
+        return (*f_)(*iter_);
+    }
+    void increment() { ++iter_; }
+    bool equal(const map_iterator& other) const { return iter_ == other.iter_; }
+
+    Iterator iter_;
+    box<Function> f_;
+};
+
+// Yields only those elements of the underlying range satisfying p
+template <typename Iterator, typename Predicate>
+class filter_iterator
+    : public view_iterator_base<
+          filter_iterator<Iterator, Predicate>,
+          typename std::iterator_traits<Iterator>::value_type,
+          typename cursor<Iterator>::reference,
+          iterator_difference_t<Iterator>> {
+    friend class view_iterator_base<
+        filter_iterator, typename std::iterator_traits<Iterator>::value_type,
+        typename cursor<Iterator>::reference, iterator_difference_t<Iterator>>;
+
+public:
+    filter_iterator(Iterator iter, Iterator last, const Predicate& p)
+        : cursor_(iter), last_(last), p_(p) {
+        satisfy();
+    }
+
+private:
+    typename cursor<Iterator>::reference dereference() const {
+        return cursor_.get();
+    }
+
+    void increment() {
+        ++cursor_.iter;
+        satisfy();
+    }
+
+    bool equal(const filter_iterator& other) const {
+        return cursor_.iter == other.cursor_.iter;
+    }
+
+    // Advance to the next element satisfying the predicate
+    void satisfy() {
+        for (; cursor_.iter != last_; ++cursor_.iter) {
+            cursor_.load();
+            if ((*p_)(cursor_.get())) {
+                return;
+            }
+        }
+    }
+
+    cursor<Iterator> cursor_;
+    Iterator last_;
+    box<Predicate> p_;
+};
+
+// Yields at most 'count' elements of the underlying range
+template <typename Iterator>
+class take_iterator
+    : public view_iterator_base<
+          take_iterator<Iterator>,
+          typename std::iterator_traits<Iterator>::value_type,
+          typename std::iterator_traits<Iterator>::reference,
+          iterator_difference_t<Iterator>> {
+    friend class view_iterator_base<
+        take_iterator, typename std::iterator_traits<Iterator>::value_type,
+        typename std::iterator_traits<Iterator>::reference,
+        iterator_difference_t<Iterator>>;
+
+public:
+    take_iterator(Iterator iter, Iterator last,
+                  iterator_difference_t<Iterator> count)
+        : iter_(iter), last_(last), count_(count) {}
+
+private:
+    typename std::iterator_traits<Iterator>::reference dereference() const {
+        return *iter_;
+    }
+
+    // The underlying iterator is not advanced past the final element, so
+    // expensive upstream stages (e.g., filter) never search for an element
+    // which will not be used.
+    void increment() {
+        if (--count_ != 0) {
+            ++iter_;
+        }
+    }
+
+    bool done() const { return count_ <= 0 || iter_ == last_; }
+
+    bool equal(const take_iterator& other) const {
+        if (done() || other.done()) {
+            return done() == other.done();
+        }
+        return iter_ == other.iter_;
+    }
+
+    Iterator iter_;
+    Iterator last_;
+    iterator_difference_t<Iterator> count_;
+};
+
+// Yields elements of the underlying range until p is not satisfied
+template <typename Iterator, typename Predicate>
+class take_while_iterator
+    : public view_iterator_base<
+          take_while_iterator<Iterator, Predicate>,
+          typename std::iterator_traits<Iterator>::value_type,
+          typename cursor<Iterator>::reference,
+          iterator_difference_t<Iterator>> {
+    friend class view_iterator_base<
+        take_while_iterator,
+        typename std::iterator_traits<Iterator>::value_type,
+        typename cursor<Iterator>::reference, iterator_difference_t<Iterator>>;
+
+public:
+    take_while_iterator(Iterator iter, Iterator last, const Predicate& p)
+        : cursor_(iter), last_(last), p_(p), done_(false) {
+        check();
+    }
+
+private:
+    typename cursor<Iterator>::reference dereference() const {
+        return cursor_.get();
+    }
+
+    void increment() {
+        ++cursor_.iter;
+        check();
+    }
+
+    bool equal(const take_while_iterator& other) const {
+        if (done_ || other.done_) {
+            return done_ == other.done_;
+        }
+        return cursor_.iter == other.cursor_.iter;
+    }
+
+    void check() {
+        if (cursor_.iter == last_) {
+            done_ = true;
+            return;
+        }
+        cursor_.load();
+        done_ = !(*p_)(cursor_.get());
+    }
+
+    cursor<Iterator> cursor_;
+    Iterator last_;
+    box<Predicate> p_;
+    bool done_;
+};
+
+template <typename First, typename Second>
+using zip_pair_t = std::pair<
+    typename std::decay<
+        typename std::iterator_traits<First>::reference>::type,
+    typename std::decay<
+        typename std::iterator_traits<Second>::reference>::type>;
+
+// Yields pairs of elements from two ranges until either is exhausted
+template <typename First, typename Second>
+class zip_iterator
+    : public view_iterator_base<zip_iterator<First, Second>,
+                                zip_pair_t<First, Second>,
+                                zip_pair_t<First, Second>,
+                                iterator_difference_t<First>> {
+    friend class view_iterator_base<zip_iterator, zip_pair_t<First, Second>,
+                                    zip_pair_t<First, Second>,
+                                    iterator_difference_t<First>>;
+
+public:
+    zip_iterator(First first, First first_last, Second second,
+                 Second second_last)
+        : first_(first), first_last_(first_last), second_(second),
+          second_last_(second_last) {}
+
+private:
+    zip_pair_t<First, Second> dereference() const {
+        return zip_pair_t<First, Second>(*first_, *second_);
+    }
+
+    void increment() {
+        ++first_;
+        ++second_;
+    }
+
+    bool done() const {
+        return first_ == first_last_ || second_ == second_last_;
+    }
+
+    bool equal(const zip_iterator& other) const {
+        if (done() || other.done()) {
+            return done() == other.done();
+        }
+        return first_ == other.first_ && second_ == other.second_;
+    }
+
+    First first_;
+    First first_last_;
+    Second second_;
+    Second second_last_;
+};
+
+// Whether every iterator in 'Iterators' is random access
+template <typename... Iterators>
+struct all_random_access : std::true_type {};
+
+template <typename Iterator, typename... Iterators>
+struct all_random_access<Iterator, Iterators...>
+    : std::integral_constant<
+          bool,
+          std::is_base_of<std::random_access_iterator_tag,
+                          typename std::iterator_traits<
+                              Iterator>::iterator_category>::value &&
+              all_random_access<Iterators...>::value> {};
+
+template <typename... Iterators>
+using zip_value_t =
+    std::tuple<typename std::iterator_traits<Iterators>::value_type...>;
+
+// A tuple of the references yielded by each iterator, so writing through
+// it modifies the underlying ranges
+template <typename... Iterators>
+using zip_reference_t =
+    std::tuple<typename std::iterator_traits<Iterators>::reference...>;
+
+template <typename... Iterators, std::size_t... Indexes>
+zip_reference_t<Iterators...>
+dereference_iter_tuple(const std::tuple<Iterators...>& iters,
+                       index_pack<Indexes...>) {
+    return zip_reference_t<Iterators...>(*std::get<Indexes>(iters)...);
+}
+
+// Yields tuples of references to the elements of several ranges, in
+// lock-step, until any of them is exhausted. Each range is walked once, and
+// their sizes are never computed.
+template <bool RandomAccess, typename... Iterators>
+class zip_n_iterator
+    : public view_iterator_base<zip_n_iterator<RandomAccess, Iterators...>,
+                                zip_value_t<Iterators...>,
+                                zip_reference_t<Iterators...>,
+                                std::ptrdiff_t> {
+    friend class view_iterator_base<zip_n_iterator, zip_value_t<Iterators...>,
+                                    zip_reference_t<Iterators...>,
+                                    std::ptrdiff_t>;
+
+public:
+    zip_n_iterator(std::tuple<Iterators...> iters,
+                   std::tuple<Iterators...> lasts)
+        : iters_(iters), lasts_(lasts) {}
+
+private:
+    zip_reference_t<Iterators...> dereference() const {
+        return dereference_iter_tuple(
+            iters_, make_index_pack<sizeof...(Iterators)>());
+    }
+
+    void increment() { advance_iter_tuple(iters_); }
+
+    bool done() const {
+        return done_from(std::integral_constant<std::size_t, 0>{});
+    }
+
+    // Whether any of the iterators from the I'th onwards is exhausted
+    template <std::size_t I>
+    bool done_from(std::integral_constant<std::size_t, I>) const {
+        return std::get<I>(iters_) == std::get<I>(lasts_) ||
+               done_from(std::integral_constant<std::size_t, I + 1>{});
+    }
+
+    bool done_from(
+        std::integral_constant<std::size_t, sizeof...(Iterators)>) const {
+        return false;
+    }
+
+    bool equal(const zip_n_iterator& other) const {
+        bool is_done = done();
+        bool other_done = other.done();
+        if (is_done || other_done) {
+            return is_done == other_done;
+        }
+        return iters_ == other.iters_;
+    }
+
+    std::tuple<Iterators...> iters_;
+    std::tuple<Iterators...> lasts_;
+};
+
+// When every range is random access, the end of the zip is found up front
+// (by truncating each range to the shortest), so the iterator only needs
+// the current positions, and is itself random access.
+template <typename... Iterators>
+class zip_n_iterator<true, Iterators...> {
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = zip_value_t<Iterators...>;
+    using reference = zip_reference_t<Iterators...>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+
+    explicit zip_n_iterator(std::tuple<Iterators...> iters) : iters_(iters) {}
+
+    reference operator*() const {
+        return dereference_iter_tuple(
+            iters_, make_index_pack<sizeof...(Iterators)>());
+    }
+
+    reference operator[](difference_type n) const { return *(*this + n); }
+
+    zip_n_iterator& operator++() { return *this += 1; }
+
+    zip_n_iterator operator++(int) {
+        zip_n_iterator copy(*this);
+        *this += 1;
+        return copy;
+    }
+
+    zip_n_iterator& operator--() { return *this -= 1; }
+
+    zip_n_iterator operator--(int) {
+        zip_n_iterator copy(*this);
+        *this -= 1;
+        return copy;
+    }
+
+    zip_n_iterator& operator+=(difference_type n) {
+        advance_by(n, make_index_pack<sizeof...(Iterators)>());
+        return *this;
+    }
+
+    zip_n_iterator& operator-=(difference_type n) { return *this += -n; }
+
+    friend zip_n_iterator operator+(zip_n_iterator iter, difference_type n) {
+        return iter += n;
+    }
+
+    friend zip_n_iterator operator+(difference_type n, zip_n_iterator iter) {
+        return iter += n;
+    }
+
+    friend zip_n_iterator operator-(zip_n_iterator iter, difference_type n) {
+        return iter -= n;
+    }
+
+    // The iterators all move together, so comparing the first is enough
+    friend difference_type operator-(const zip_n_iterator& lhs,
+                                     const zip_n_iterator& rhs) {
+        return std::get<0>(lhs.iters_) - std::get<0>(rhs.iters_);
+    }
+
+    friend bool operator==(const zip_n_iterator& lhs,
+                           const zip_n_iterator& rhs) {
+        return std::get<0>(lhs.iters_) == std::get<0>(rhs.iters_);
+    }
+
+    friend bool operator!=(const zip_n_iterator& lhs,
+                           const zip_n_iterator& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const zip_n_iterator& lhs,
+                          const zip_n_iterator& rhs) {
+        return std::get<0>(lhs.iters_) < std::get<0>(rhs.iters_);
+    }
+
+    friend bool operator>(const zip_n_iterator& lhs,
+                          const zip_n_iterator& rhs) {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const zip_n_iterator& lhs,
+                           const zip_n_iterator& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const zip_n_iterator& lhs,
+                           const zip_n_iterator& rhs) {
+        return !(lhs < rhs);
+    }
+
+private:
+    template <std::size_t... Indexes>
+    void advance_by(difference_type n, index_pack<Indexes...>) {
+        allow_naked_pack_expansion((std::get<Indexes>(iters_) += n, 0)...);
+    }
+
+    std::tuple<Iterators...> iters_;
+};
+
+template <typename... Iterators>
+using zip_n_iterator_t =
+    zip_n_iterator<all_random_access<Iterators...>::value, Iterators...>;
+
+} // end detail
+} // end cec
+
+#endif
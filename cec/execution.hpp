@@ -0,0 +1,61 @@
+#ifndef CEC_EXECUTION
+#define CEC_EXECUTION
+
+#include <type_traits>
+
+namespace cec {
+
+/**
+ * The execution namespace contains the execution policy types accepted by
+ * the parallel overloads of extended_sequence_container.
+ *
+ * These mirror the policies of C++17's \a std::execution, but are usable
+ * with C++11.
+ */
+namespace execution {
+
+/**
+ * @brief Policy requesting that an operation be performed serially on the
+ * calling thread
+ */
+struct sequenced_policy {};
+
+/**
+ * @brief Policy permitting an operation to be split across a pool of threads
+ */
+struct parallel_policy {};
+
+/**
+ * @brief Policy permitting an operation to be split across a pool of threads
+ * and vectorized within each thread
+ */
+struct parallel_unsequenced_policy {};
+} // end execution
+
+/// Execution policy object for serial execution
+constexpr execution::sequenced_policy seq{};
+
+/// Execution policy object for parallel execution
+constexpr execution::parallel_policy par{};
+
+/// Execution policy object for parallel and vectorized execution
+constexpr execution::parallel_unsequenced_policy par_unseq{};
+
+/**
+ * @brief Determine whether \a T is an execution policy type
+ */
+template <typename T>
+struct is_execution_policy : std::false_type {};
+
+template <>
+struct is_execution_policy<execution::sequenced_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_policy> : std::true_type {};
+
+template <>
+struct is_execution_policy<execution::parallel_unsequenced_policy>
+    : std::true_type {};
+} // end cec
+
+#endif
@@ -2,10 +2,23 @@
 #define CEC_EXTENDED_SEQUENCE_CONTAINER
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
 #include <utility>
 #include <type_traits>
 #include <iterator>
+#include <unordered_map>
+#include <vector>
+#include <cec/execution.hpp>
+#include <cec/sink.hpp>
+#include <cec/detail/compact.hpp>
 #include <cec/detail/extended_sequence_container.hpp>
+#include <cec/detail/flat_hash_set.hpp>
+#include <cec/detail/parallel.hpp>
+#include <cec/detail/search.hpp>
+#include <cec/detail/sort.hpp>
+#include <cec/view.hpp>
 
 /**
  * The cec namespace contains mixins for the various container types
@@ -13,6 +26,29 @@
  */
 namespace cec {
 
+// Defined in cec/soa_vector.hpp, which must be included to use unzip_soa()
+// and zip_soa()
+template <typename... Ts>
+class basic_soa_vector;
+
+namespace detail {
+
+// The structure of arrays with a column for each field of 'Row' (a
+// std::pair or std::tuple)
+template <typename Row>
+struct soa_of;
+
+template <typename T1, typename T2>
+struct soa_of<std::pair<T1, T2>> {
+    using type = basic_soa_vector<T1, T2>;
+};
+
+template <typename... Ts>
+struct soa_of<std::tuple<Ts...>> {
+    using type = basic_soa_vector<Ts...>;
+};
+} // end detail
+
 /**
  * @brief The extended container mixin for types satisfying the requirements
  * for <a href="http://en.cppreference.com/w/cpp/concept/SequenceContainer">
@@ -63,6 +99,32 @@ class extended_sequence_container : public SequenceContainer {
         rebind_as_extended_container<typename detail::pack_value_types<
             SequenceContainer, Containers...>::type>;
 
+    // The set of keys seen by distinct_by()
+    template <typename KeyFunction>
+    using distinct_key_set =
+        detail::flat_hash_set<typename std::decay<decltype(
+            std::declval<KeyFunction&>()(std::declval<
+                const typename SequenceContainer::value_type&>()))>::type>;
+
+    template <typename Key>
+    using group_by_t = std::unordered_map<typename std::decay<Key>::type,
+                                          extended_sequence_container>;
+
+    // Whether group_by() sizes each group before filling it. Growing a group
+    // of trivially copyable elements costs little more than the extra pass
+    // over the container needed to size it.
+    using presize_groups = std::integral_constant<
+        bool, detail::has_reserve<SequenceContainer>::value &&
+                  !std::is_trivially_copyable<
+                      typename SequenceContainer::value_type>::value>;
+
+    using partition_t =
+        std::pair<extended_sequence_container, extended_sequence_container>;
+
+    template <typename Iterator, typename... Containers>
+    using zip_view_t = sequence_view<detail::zip_n_iterator_t<
+        Iterator, decltype(std::begin(std::declval<Containers&>()))...>>;
+
 public:
     // Inherit T's constructors
     using SequenceContainer::SequenceContainer;
@@ -89,7 +151,16 @@ public:
      */
     template <typename Container>
     extended_sequence_container concat(const Container& container) const & {
-        return extended_sequence_container(*this).extend(container);
+        auto concatenated =
+            detail::make_rebound<extended_sequence_container>(*this);
+        detail::reserve_hint(concatenated, [&] {
+            return detail::container_size(*this) +
+                   detail::container_size(container);
+        });
+        auto append = detail::make_appender(concatenated);
+        append.insert(this->begin(), this->end());
+        append.insert(container.begin(), container.end());
+        return concatenated;
     }
 
     // When 'this' is a modifiable r-value, just extend in-place
@@ -101,12 +172,41 @@ public:
     /**
      * @brief Test whether \a value is within this container
      *
+     * For strings, \a value may also be a string, in which case this
+     * tests whether it is a substring of this one.
+     *
+     * @code
+     * cec::string s = "hello world";
+     * s.contains('w');     // true
+     * s.contains("o w");   // true
+     * s.contains("olleh"); // false
+     * @endcode
+     *
      * @param[in] value - The value to check for
      * @return \p true if \a value is within this container, \p false otherwise
      */
     template <typename T>
     bool contains(const T& value) const {
-        return std::find(this->begin(), this->end(), value) != this->end();
+        return contains_serial(
+            value, detail::search_strategy<SequenceContainer, T>{});
+    }
+
+    /**
+     * @brief Test whether \a value is within this container, searching with
+     * the given execution policy
+     *
+     * When \a policy is cec::par or cec::par_unseq and this container is
+     * random access, the search is split across a pool of threads.
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] value - The value to check for
+     * @return \p true if \a value is within this container, \p false otherwise
+     */
+    template <typename ExecutionPolicy, typename T>
+    detail::enable_if_execution_policy<ExecutionPolicy, bool>
+    contains(ExecutionPolicy&&, const T& value) const {
+        return contains_helper(
+            value, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
     }
 
     /**
@@ -118,7 +218,22 @@ public:
      */
     typename SequenceContainer::difference_type
     count(const value_type& value) const {
-        return std::count(this->begin(), this->end(), value);
+        return count_serial(value, detail::is_searchable<SequenceContainer>{});
+    }
+
+    /**
+     * @brief Counts the elements equal to \a value in this container using
+     * the given execution policy
+     * @param[in] policy - The execution policy to use
+     * @param[in] value - The value to count
+     * @returns The number of occurrences of \a value
+     */
+    template <typename ExecutionPolicy>
+    detail::enable_if_execution_policy<
+        ExecutionPolicy, typename SequenceContainer::difference_type>
+    count(ExecutionPolicy&& policy, const value_type& value) const {
+        return count_if(std::forward<ExecutionPolicy>(policy),
+                        [&value](const value_type& v) { return v == value; });
     }
 
     /**
@@ -133,17 +248,110 @@ public:
     template <typename UnaryPredicate>
     typename SequenceContainer::difference_type
     count_if(UnaryPredicate p) const {
-        return std::count_if(this->begin(), this->end(), p);
+        return count_if_serial(p, detail::is_searchable<SequenceContainer>{});
+    }
+
+    /**
+     * @brief Count the occurrences of values satisfying a predicate in
+     * this container using the given execution policy
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] p - The predicate. Must be safe to invoke concurrently
+     * @returns The number of values which satisfy \a p
+     */
+    template <typename ExecutionPolicy, typename UnaryPredicate>
+    detail::enable_if_execution_policy<
+        ExecutionPolicy, typename SequenceContainer::difference_type>
+    count_if(ExecutionPolicy&&, UnaryPredicate p) const {
+        return count_if_helper(
+            p, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
+    }
+
+    /**
+     * @brief Create a copy of this container without duplicate elements
+     *
+     * The first occurrence of each element is kept, in its original order.
+     * Elements are found in an open addressing hash set of pointers to them,
+     * so that they are hashed with std::hash but neither copied nor
+     * allocated individually.
+     *
+     * @code
+     * cec::vector<int> numbers = {3, 1, 3, 2, 1};
+     * auto unique = numbers.distinct(); // {3, 1, 2}
+     * @endcode
+     *
+     * @return The elements of this container, without duplicates
+     */
+    extended_sequence_container distinct() const & {
+        auto unique = detail::make_rebound<extended_sequence_container>(*this);
+        auto append = detail::make_appender(unique);
+        detail::indirect_hash_set<value_type> seen;
+        for (const auto& item : *this) {
+            if (seen.insert(&item)) {
+                append.emplace(item);
+            }
+        }
+        return unique;
+    }
+
+    // If 'this' is a modifiable r-value, the first occurrences are compacted
+    // to the front in place, as by remove_if (or the duplicates are unlinked,
+    // for lists)
+    extended_sequence_container distinct() && {
+        distinct_helper(detail::has_remove_if<SequenceContainer>{});
+        return std::move(*this);
+    }
+
+    /**
+     * @brief Create a copy of this container without elements whose keys
+     *        duplicate those of earlier elements
+     *
+     * \a key is evaluated once per element, and the keys are stored in an
+     * open addressing hash set.
+     *
+     * @code
+     * cec::vector<std::string> words = {"apple", "avocado", "banana"};
+     * auto by_initial = words.distinct_by(
+     *     [](const std::string& s) { return s[0]; }); // {"apple", "banana"}
+     * @endcode
+     *
+     * @param[in] key - The function computing the key of each element
+     * @return The first element of this container with each key
+     */
+    template <typename KeyFunction>
+    extended_sequence_container distinct_by(KeyFunction key) const & {
+        auto unique = detail::make_rebound<extended_sequence_container>(*this);
+        auto append = detail::make_appender(unique);
+        distinct_key_set<KeyFunction> seen;
+        for (const auto& item : *this) {
+            if (seen.insert(key(item))) {
+                append.emplace(item);
+            }
+        }
+        return unique;
+    }
+
+    template <typename KeyFunction>
+    extended_sequence_container distinct_by(KeyFunction key) && {
+        distinct_key_set<KeyFunction> seen;
+        auto duplicate = [&](const value_type& v) {
+            return !seen.insert(key(v));
+        };
+        remove_if_helper(duplicate, detail::has_remove_if<SequenceContainer>{});
+        return std::move(*this);
     }
 
     /**
      * @brief Remove all items in this container that are equal to value
+     *
+     * Lists unlink the nodes of the removed items, rather than moving the
+     * items that are kept.
+     *
      * @param[in] value - The value to compare each item against
      * @returns A reference to this container
      */
-    extended_sequence_container erase_all(const value_type& value) {
-        this->erase(std::remove(this->begin(), this->end(), value),
-                    this->end());
+    extended_sequence_container& erase_all(const value_type& value) {
+        erase_all_helper(value, detail::has_remove<SequenceContainer>{});
         return *this;
     }
 
@@ -163,7 +371,25 @@ public:
      */
     template <typename UnaryPredicate>
     extended_sequence_container& erase_if(UnaryPredicate p) {
-        this->erase(std::remove_if(this->begin(), this->end(), p), this->end());
+        erase_if_serial(p, detail::is_compactable<SequenceContainer>{});
+        return *this;
+    }
+
+    /**
+     * @brief Remove the items satisfying a predicate using the given execution
+     * policy
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] p - The predication function. Must be safe to invoke
+     *                concurrently
+     * @return A reference to this container
+     */
+    template <typename ExecutionPolicy, typename UnaryPredicate>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container&>
+    erase_if(ExecutionPolicy&&, UnaryPredicate p) {
+        erase_if_helper(
+            p, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
         return *this;
     }
 
@@ -177,7 +403,16 @@ public:
      */
     template <typename Container>
     extended_sequence_container& extend(const Container& container) {
-        this->insert(this->end(), container.begin(), container.end());
+        detail::make_appender(*this).insert(container.begin(),
+                                            container.end());
+        return *this;
+    }
+
+    // The elements of a modifiable r-value of the same type are moved (or
+    // spliced, for lists) rather than copied
+    extended_sequence_container& extend(extended_sequence_container&& other) {
+        extend_helper(
+            other, detail::has_splice<SequenceContainer, SequenceContainer>{});
         return *this;
     }
 
@@ -193,12 +428,12 @@ public:
      */
     template <typename UnaryPredicate>
     extended_sequence_container filter(UnaryPredicate p) const & {
-        extended_sequence_container temp;
-        for (const auto& item : *this) {
-            if (p(item)) {
-                temp.emplace(temp.end(), item);
-            }
-        }
+        auto temp = detail::make_rebound<extended_sequence_container>(*this);
+
+        // Reserve for the worst case, in which every element is kept
+        detail::reserve_hint(temp,
+                             [this] { return detail::container_size(*this); });
+        filter_into(temp, p, detail::is_compactable<SequenceContainer>{});
         return temp;
     }
 
@@ -209,37 +444,131 @@ public:
             this->erase_if([&p](const value_type& v) { return !p(v); }));
     }
 
+    /**
+     * @brief Create a copy of this container with all elements that satisfy
+     * the predicate function, using the given execution policy
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] p - The predication function. Must be safe to invoke
+     *                concurrently
+     * @return The filtered container
+     */
+    template <typename ExecutionPolicy, typename UnaryPredicate>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container>
+    filter(ExecutionPolicy&&, UnaryPredicate p) const & {
+        return filter_helper(
+            p, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
+    }
+
+    template <typename ExecutionPolicy, typename UnaryPredicate>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container>
+    filter(ExecutionPolicy&& policy, UnaryPredicate p) && {
+        return std::move(
+            this->erase_if(std::forward<ExecutionPolicy>(policy),
+                           [&p](const value_type& v) { return !p(v); }));
+    }
+
     /**
      * @brief Convert a container of containers into a single container
      * @return A copy of this container with one level of nesting removed
      */
     template <typename Container = value_type>
     Container flatten() const & {
-        Container flattened;
+        auto flattened = detail::make_rebound<Container>(*this);
+        detail::reserve_hint(
+            flattened, [this] { return detail::nested_container_size(*this); });
 
+        auto append = detail::make_appender(flattened);
         for (const auto& innerContainer : *this) {
-            flattened.insert(flattened.end(), innerContainer.begin(),
-                             innerContainer.end());
+            append.insert(innerContainer.begin(), innerContainer.end());
         }
 
         return flattened;
     }
 
     // If 'this' is a modifiable r-value, we can destroy the inner containers
-    // while we build the new one
+    // while we build the new one. Lists are spliced together rather than
+    // having their elements moved.
     template <typename Container = value_type>
     Container flatten() && {
-        Container flattened;
+        auto flattened = detail::make_rebound<Container>(*this);
+        flatten_helper(flattened, detail::has_splice<Container, value_type>{});
+        return flattened;
+    }
 
-        for (auto&& innerContainer : *this) {
-            flattened.insert(flattened.end(),
-                             std::make_move_iterator(innerContainer.begin()),
-                             std::make_move_iterator(innerContainer.end()));
-        }
+    /**
+     * @brief Convert nested containers of any depth into a single container
+     *
+     * Elements are extracted from the innermost containers, whose elements
+     * are not themselves containers (strings are not considered containers
+     * here, and are kept whole). The result is allocated once, for the total
+     * number of elements, if it supports reserve().
+     *
+     * @code
+     * cec::vector<cec::vector<cec::vector<int>>> nested = {{{1, 2}, {3}},
+     *                                                      {{4}}};
+     * cec::vector<int> flat = nested.flatten_all(); // {1, 2, 3, 4}
+     * @endcode
+     *
+     * @return A copy of the elements of the innermost containers (or of
+     * this container, if its elements are not containers)
+     */
+    template <typename Container = typename detail::innermost_container<
+                  extended_sequence_container>::type>
+    Container flatten_all() const & {
+        auto flattened = detail::make_rebound<Container>(*this);
+        detail::reserve_hint(flattened,
+                             [this] { return detail::leaf_count(*this); });
+        auto append = detail::make_appender(flattened);
+        detail::append_leaves(append, *this);
+        return flattened;
+    }
 
+    // If 'this' is a modifiable r-value, the elements are moved
+    template <typename Container = typename detail::innermost_container<
+                  extended_sequence_container>::type>
+    Container flatten_all() && {
+        auto flattened = detail::make_rebound<Container>(*this);
+        detail::reserve_hint(flattened,
+                             [this] { return detail::leaf_count(*this); });
+        auto append = detail::make_appender(flattened);
+        detail::append_leaves(append, std::move(*this));
         return flattened;
     }
 
+    /**
+     * @brief Split this container in to groups of elements with equal keys
+     *
+     * Each element is placed in the group for the key \a key returns for it,
+     * preserving their order, and \a key is evaluated once per element.
+     * Where the containers support reserve() and the elements are not
+     * trivially copyable, each group is allocated once, for its final size.
+     *
+     * @code
+     * cec::vector<int> numbers = {1, 2, 3, 4, 5};
+     * auto by_parity = numbers.group_by([](int i) { return i % 2; });
+     * // by_parity == { {1, {1, 3, 5}}, {0, {2, 4}} }
+     * @endcode
+     *
+     * @param[in] key - The function computing the key of each element
+     * @return A hash map from each key to the elements with that key
+     */
+    template <typename KeyFunction>
+    auto group_by(KeyFunction key) const
+        & -> group_by_t<decltype(key(*this->begin()))> {
+        return group_by_helper(*this, key, presize_groups{});
+    }
+
+    // If 'this' is a modifiable r-value, the elements are moved in to their
+    // groups
+    template <typename KeyFunction>
+    auto group_by(KeyFunction key) && -> group_by_t<decltype(
+        key(*this->begin()))> {
+        return group_by_helper(std::move(*this), key, presize_groups{});
+    }
+
     /**
      * @brief Create a container by applying a function to each element of
      * this container
@@ -257,11 +586,13 @@ public:
     auto map(UnaryFunction f) const
         & -> rebind_as_extended_container<decltype(f(*this->begin()))> {
 
-        extended_sequence_container<typename detail::rebind_sequence_container<
-            SequenceContainer>::template other<decltype(f(*this->begin()))>>
-            mapped;
+        auto mapped = detail::make_rebound<
+            rebind_as_extended_container<decltype(f(*this->begin()))>>(*this);
+        detail::reserve_hint(mapped,
+                             [this] { return detail::container_size(*this); });
+        auto append = detail::make_appender(mapped);
         for (const auto& item : *this) {
-            mapped.emplace(mapped.end(), f(item));
+            append.emplace(f(item));
         }
         return mapped;
     }
@@ -276,24 +607,251 @@ public:
         return std::move(this->transform(f));
     }
 
+    /**
+     * @brief Create a container by applying a function to each element of
+     * this container using the given execution policy
+     *
+     * When \a policy is cec::par or cec::par_unseq and this container is
+     * random access, the elements are split in to chunks which are mapped on
+     * a pool of threads. The results are in the same order as this container.
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] f - The function to map across this container. Must be safe
+     *                to invoke concurrently
+     * @return A new container with \a f applied to each element
+     */
+    template <typename ExecutionPolicy, typename UnaryFunction>
+    auto map(ExecutionPolicy&&, UnaryFunction f) const & -> detail::
+        enable_if_execution_policy<
+            ExecutionPolicy,
+            rebind_as_extended_container<decltype(f(*this->begin()))>> {
+        return map_helper(
+            f, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
+    }
+
+    /**
+     * @brief Create a container by applying a function returning a container
+     * to each element of this container, and concatenating the results
+     *
+     * This is equivalent to map(f).flatten(), but the elements returned by
+     * \a f are appended directly to the result (and moved, if \a f returns
+     * by value), without building the container of containers in between.
+     *
+     * @param[in] f - The function to map across this container
+     * @return A new container with the elements of each result of \a f
+     *
+     * \see To emit elements without returning a container: flat_map<T>()
+     */
+    template <typename UnaryFunction>
+    auto flat_map(UnaryFunction f) const & -> rebind_as_extended_container<
+        typename std::decay<decltype(f(*this->begin()))>::type::value_type> {
+        using element_type = typename std::decay<decltype(
+            f(*this->begin()))>::type::value_type;
+        auto mapped = detail::make_rebound<
+            rebind_as_extended_container<element_type>>(*this);
+        auto append = detail::make_appender(mapped);
+        for (const auto& item : *this) {
+            detail::append_range(append, f(item));
+        }
+        return mapped;
+    }
+
+    // If 'this' is a modifiable r-value, the elements are moved in to 'f'
+    template <typename UnaryFunction>
+    auto flat_map(UnaryFunction f) && -> rebind_as_extended_container<
+        typename std::decay<decltype(f(*this->begin()))>::type::value_type> {
+        using element_type = typename std::decay<decltype(
+            f(*this->begin()))>::type::value_type;
+        auto mapped = detail::make_rebound<
+            rebind_as_extended_container<element_type>>(*this);
+        auto append = detail::make_appender(mapped);
+        for (auto& item : *this) {
+            detail::append_range(append, f(std::move(item)));
+        }
+        return mapped;
+    }
+
+    /**
+     * @brief Create a container of \a T from the elements emitted by a
+     * function applied to each element of this container
+     *
+     * \a f is called with each element and a cec::sink appending to the
+     * result, and may emit any number of elements to it. Unlike
+     * flat_map(f), no container is built for each call.
+     *
+     * @code
+     * cec::vector<std::string> lines = {"a b", "c"};
+     * using words_type = cec::vector<std::string>;
+     * words_type words = lines.flat_map<std::string>(
+     *     [](const std::string& line, cec::sink<words_type>& out) {
+     *         std::size_t first = 0, last;
+     *         while ((last = line.find(' ', first)) != std::string::npos) {
+     *             out(line.substr(first, last - first));
+     *             first = last + 1;
+     *         }
+     *         out(line.substr(first));
+     *     });
+     * // words == {"a", "b", "c"}
+     * @endcode
+     *
+     * @param[in] f - The function to apply, taking an element and a
+     *                cec::sink<rebind_as_extended_container<T>>&
+     * @return A new container with every element emitted by \a f
+     */
+    template <typename T, typename BinaryFunction>
+    rebind_as_extended_container<T> flat_map(BinaryFunction f) const & {
+        auto mapped =
+            detail::make_rebound<rebind_as_extended_container<T>>(*this);
+        sink<rebind_as_extended_container<T>> out(mapped);
+        for (const auto& item : *this) {
+            f(item, out);
+        }
+        return mapped;
+    }
+
+    // If 'this' is a modifiable r-value, the elements are moved in to 'f'
+    template <typename T, typename BinaryFunction>
+    rebind_as_extended_container<T> flat_map(BinaryFunction f) && {
+        auto mapped =
+            detail::make_rebound<rebind_as_extended_container<T>>(*this);
+        sink<rebind_as_extended_container<T>> out(mapped);
+        for (auto& item : *this) {
+            f(std::move(item), out);
+        }
+        return mapped;
+    }
+
+    /**
+     * @brief Folds \a f over the elements of this container from left to
+     * right, starting from \a init.
+     *
+     * Unlike reduce(), \a f need not be associative. The accumulator is
+     * never copied: if \a f accepts it as an rvalue, it is moved in to \a f
+     * and replaced by the result. Otherwise \a f may take it by lvalue
+     * reference and update it in place, returning nothing. Either way,
+     * accumulating a string or container takes time linear in its final
+     * size.
+     *
+     * @param[in] f - Function combining the accumulator and an element
+     * @param[in] init - The initial value of the accumulator
+     * @return The final value of the accumulator
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<std::string> parts = {"Hel", "lo", ", wo", "rld"};
+     *    std::string msg = parts.fold_left(
+     *        [](std::string& msg, const std::string& part) { msg += part; },
+     *        std::string());
+     *    // msg == "Hello, world"
+     * @endcode
+     */
+    template <typename BinaryFunction, typename Init>
+    Init fold_left(BinaryFunction f, Init init) const & {
+        return detail::fold_left(this->begin(), this->end(), std::move(init),
+                                 f);
+    }
+
+    // If 'this' is modifiable, the elements are moved in to 'f'
+    template <typename BinaryFunction, typename Init>
+    Init fold_left(BinaryFunction f, Init init) && {
+        return detail::fold_left(std::make_move_iterator(this->begin()),
+                                 std::make_move_iterator(this->end()),
+                                 std::move(init), f);
+    }
+
+    /**
+     * @brief Merge the sorted elements of \a other in to this sorted
+     * container
+     *
+     * As with std::list::merge, \a other is left empty, and the merge is
+     * stable. Lists relink the nodes of \a other; other containers move
+     * its elements to the end of this one, then merge the two ranges with
+     * std::inplace_merge.
+     *
+     * @param[in] other - The sorted container to merge
+     * @param[in] comp - The comparator both containers are sorted by
+     * @return A reference to this container
+     */
+    template <typename Compare = std::less<value_type>>
+    extended_sequence_container& merge(extended_sequence_container& other,
+                                       Compare comp = Compare()) {
+        if (&other != this) {
+            merge_helper(other, comp, detail::has_merge<SequenceContainer>{});
+        }
+        return *this;
+    }
+
+    template <typename Compare = std::less<value_type>>
+    extended_sequence_container& merge(extended_sequence_container&& other,
+                                       Compare comp = Compare()) {
+        return merge(other, comp);
+    }
+
+    /**
+     * @brief Split this container in to the elements which satisfy a
+     * predicate and those which do not
+     *
+     * Unlike calling filter() twice, this container is traversed once and
+     * \a p is evaluated once for each element. The order of the elements is
+     * preserved in both results.
+     *
+     * @param[in] p - The predicate
+     * @return A pair of containers: the elements satisfying \a p, then the
+     * rest
+     */
+    template <typename UnaryPredicate>
+    partition_t partition(UnaryPredicate p) const & {
+        partition_t partitioned(
+            detail::make_rebound<extended_sequence_container>(*this),
+            detail::make_rebound<extended_sequence_container>(*this));
+        auto append_first = detail::make_appender(partitioned.first);
+        auto append_second = detail::make_appender(partitioned.second);
+        for (const auto& item : *this) {
+            if (p(item)) {
+                append_first.emplace(item);
+            } else {
+                append_second.emplace(item);
+            }
+        }
+        return partitioned;
+    }
+
+    // If 'this' is a modifiable r-value, the elements satisfying \a p are
+    // kept in place and the rest moved out (or spliced out, for lists)
+    template <typename UnaryPredicate>
+    partition_t partition(UnaryPredicate p) && {
+        auto rest = detail::make_rebound<extended_sequence_container>(*this);
+        partition_helper(
+            rest, p,
+            detail::has_splice<SequenceContainer, SequenceContainer>{});
+        return {std::move(*this), std::move(rest)};
+    }
+
     /**
      * @brief Reduces the elements of this container using the associative
      * function \a f.
      *
+     * As with fold_left(), the accumulator is moved in to \a f rather than
+     * copied, or may be updated in place by \a f.
+     *
      * @param[in] f - Associative function to use to reduce contents
      * @param[in] init - The initial element of the reduction
      * @return The value of the reduction
      */
     template <typename BinaryFunction, typename Init>
-    Init reduce(BinaryFunction f, Init init) const & {
-        return std::accumulate(this->begin(), this->end(), init, f);
+    detail::enable_if_not_execution_policy<BinaryFunction, Init>
+    reduce(BinaryFunction f, Init init) const & {
+        return detail::fold_left(this->begin(), this->end(), std::move(init),
+                                 f);
     }
 
     // If 'this' is modafiable, we can move from the underlying container
     template <typename BinaryFunction, typename Init>
-    Init reduce(BinaryFunction f, Init init) && {
-        return std::accumulate(std::make_move_iterator(this->begin()),
-                               std::make_move_iterator(this->end()), init, f);
+    detail::enable_if_not_execution_policy<BinaryFunction, Init>
+    reduce(BinaryFunction f, Init init) && {
+        return detail::fold_left(std::make_move_iterator(this->begin()),
+                                 std::make_move_iterator(this->end()),
+                                 std::move(init), f);
     }
 
     /**
@@ -309,17 +867,120 @@ public:
      * Example Usage:
      * @code
      *    cec::vector<std::string> msg_parts = {"Hel", "lo", ", wo", "rld"};
-     *    std::string msg = msg_parts.reduce([](const std::string& msg,
+     *    std::string msg = msg_parts.reduce([](std::string msg,
      *                                          const std::string& part){
-     *        return msg + part;
+     *        msg += part;
+     *        return msg;
      *    });
      *    // msg == "Hello, world"
      * @endcode
      */
     template <typename BinaryFunction>
-    value_type reduce(BinaryFunction f) const {
-        return std::accumulate(std::next(this->begin()), this->end(),
-                               *this->begin(), f);
+    value_type reduce(BinaryFunction f) const & {
+        return detail::fold_left(std::next(this->begin()), this->end(),
+                                 *this->begin(), f);
+    }
+
+    // If 'this' is modifiable, the elements are moved in to 'f'
+    template <typename BinaryFunction>
+    value_type reduce(BinaryFunction f) && {
+        auto first = std::make_move_iterator(this->begin());
+        value_type init = *first;
+        return detail::fold_left(std::next(first),
+                                 std::make_move_iterator(this->end()),
+                                 std::move(init), f);
+    }
+
+    /**
+     * @brief Reduces the elements of this container using the associative
+     * function \a f, with the given execution policy.
+     *
+     * The elements are split in to fixed size blocks which are each reduced
+     * from left to right, and the results of the blocks are then combined
+     * pairwise in a balanced tree. The shape of the tree depends only on the
+     * number of elements, so the result is identical for every policy and
+     * every number of threads, even if \a f is only approximately
+     * associative (e.g., floating point addition). This container must not
+     * be empty.
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] f - Associative function to use to reduce contents. Must be
+     *                safe to invoke concurrently
+     * @return The value of the reduction
+     */
+    template <typename ExecutionPolicy, typename BinaryFunction>
+    detail::enable_if_execution_policy<ExecutionPolicy, value_type>
+    reduce(ExecutionPolicy&&, BinaryFunction f) const & {
+        using iterator = typename SequenceContainer::const_iterator;
+        return detail::tree_reduce<value_type>(
+            this->begin(), detail::container_size(*this),
+            [&f](iterator first, iterator last) {
+                return detail::fold_left(std::next(first), last,
+                                         value_type(*first), f);
+            },
+            f, detail::is_parallel_policy<
+                   typename std::decay<ExecutionPolicy>::type>::value);
+    }
+
+    /**
+     * @brief Reduces the elements of this container in to a value of a
+     * different type, with the given execution policy.
+     *
+     * Like reduce(policy, f), the elements are split in to fixed size blocks
+     * and the result does not depend on the number of threads. Each block is
+     * reduced by folding \a f over its elements starting from \a init, and
+     * the results of the blocks are merged with \a combine. As \a init is
+     * the starting value of every block, it must be an identity of \a
+     * combine (e.g., 0 for addition).
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] f - Function combining a partial result and an element
+     * @param[in] init - The identity value of \a combine
+     * @param[in] combine - Associative function combining two partial results
+     * @return The value of the reduction, or \a init if this container is
+     * empty
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<std::string> words = {"some", "words"};
+     *    std::size_t total = words.reduce(
+     *        cec::par,
+     *        [](std::size_t sum, const std::string& s) {
+     *            return sum + s.size();
+     *        },
+     *        std::size_t{0},
+     *        [](std::size_t a, std::size_t b) { return a + b; });
+     *    // total == 9
+     * @endcode
+     */
+    template <typename ExecutionPolicy, typename BinaryFunction, typename Init,
+              typename CombineFunction>
+    detail::enable_if_execution_policy<ExecutionPolicy, Init>
+    reduce(ExecutionPolicy&&, BinaryFunction f, Init init,
+           CombineFunction combine) const & {
+        using iterator = typename SequenceContainer::const_iterator;
+        if (this->empty()) {
+            return init;
+        }
+        return detail::tree_reduce<Init>(
+            this->begin(), detail::container_size(*this),
+            [&f, &init](iterator first, iterator last) {
+                return detail::fold_left(first, last, init, f);
+            },
+            combine, detail::is_parallel_policy<
+                         typename std::decay<ExecutionPolicy>::type>::value);
+    }
+
+    /**
+     * @brief Reverse the order of the elements of this container
+     *
+     * Lists relink their nodes, rather than swapping elements.
+     *
+     * @return A reference to this container
+     */
+    extended_sequence_container& reverse() {
+        reverse_helper(detail::has_reverse<SequenceContainer>{});
+        return *this;
     }
 
     /**
@@ -329,32 +990,130 @@ public:
      * called. Otherwise, \a T must provide a member function named "sort",
      * which will be invoked.
      *
+     * If the elements are integers, floats or doubles, and \a comp is \a
+     * std::less or \a std::greater, a radix sort is used instead of \a
+     * std::sort for large random access containers.
+     *
      * @param[in] comp - The comparator to use while sorting
      * @return A reference to this container (now sorted)
      */
     template <typename Compare = std::less<value_type>>
-    extended_sequence_container& sort(Compare comp = Compare{}) {
+    detail::enable_if_not_execution_policy<Compare,
+                                           extended_sequence_container&>
+    sort(Compare comp = Compare{}) {
         sort_helper(comp, typename detail::is_random_access<
                               SequenceContainer>::type{});
         return *this;
     }
 
     /**
-     * @brief Create a new seqence from the initial elements of this sequence
+     * @brief Sort this container with the given comparator and execution
+     * policy.
      *
-     * @param[in] num - The number of elements to take from this sequence
-     * @return A new sequence from the taken elements
+     * When \a policy is cec::par or cec::par_unseq and this container is
+     * random access, chunks of the container are sorted on a pool of threads
+     * and then merged. Small containers are always sorted serially. Other
+     * containers are sorted as by sort(comp).
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] comp - The comparator to use while sorting
+     * @return A reference to this container (now sorted)
      */
-    extended_sequence_container
-    take(typename SequenceContainer::difference_type num) const & {
-        return {this->begin(), std::next(this->begin(), num)};
-    }
-
-    // When 'this' is a modifiable r-value, just erase in-place
-    extended_sequence_container
-    take(typename SequenceContainer::difference_type num) && {
-        this->erase(std::next(this->begin(), num), this->end());
-        return std::move(*this);
+    template <typename ExecutionPolicy,
+              typename Compare = std::less<value_type>>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container&>
+    sort(ExecutionPolicy&&, Compare comp = Compare{}) {
+        parallel_sort_helper(
+            comp, detail::use_parallel<ExecutionPolicy, SequenceContainer>{},
+            detail::unstable_sorter{});
+        return *this;
+    }
+
+    /**
+     * @brief Stably sort this container in ascending order of a key
+     * extracted from each element.
+     *
+     * If this container is random access and \a key returns an integer,
+     * float or double, a radix sort is used, and \a key is invoked once per
+     * element. Otherwise the elements are compared by their keys with \a
+     * std::stable_sort, or the container's member sort function.
+     *
+     * @param[in] key - Function returning the key to sort each element by
+     * @return A reference to this container (now sorted)
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<event> events = load_events();
+     *    events.sort_by([](const event& e) { return e.timestamp; });
+     * @endcode
+     */
+    template <typename KeyFunction>
+    extended_sequence_container& sort_by(KeyFunction key) {
+        sort_by_helper(key, typename detail::is_random_access<
+                                SequenceContainer>::type{});
+        return *this;
+    }
+
+    /**
+     * @brief Sort this container with the given comparator, preserving the
+     * order of equivalent elements.
+     *
+     * If \a T provides a RandomAccessIterator, then \a std::stable_sort will
+     * be called (or, as for sort(), a radix sort, which is also stable).
+     * Otherwise, \a T must provide a member function named "sort", which is
+     * assumed to be stable (as it is for std::list and std::forward_list).
+     *
+     * @param[in] comp - The comparator to use while sorting
+     * @return A reference to this container (now sorted)
+     */
+    template <typename Compare = std::less<value_type>>
+    detail::enable_if_not_execution_policy<Compare,
+                                           extended_sequence_container&>
+    stable_sort(Compare comp = Compare{}) {
+        stable_sort_helper(comp, typename detail::is_random_access<
+                                     SequenceContainer>::type{});
+        return *this;
+    }
+
+    /**
+     * @brief Stably sort this container with the given comparator and
+     * execution policy.
+     *
+     * \see sort(policy, comp)
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] comp - The comparator to use while sorting
+     * @return A reference to this container (now sorted)
+     */
+    template <typename ExecutionPolicy,
+              typename Compare = std::less<value_type>>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container&>
+    stable_sort(ExecutionPolicy&&, Compare comp = Compare{}) {
+        parallel_sort_helper(
+            comp, detail::use_parallel<ExecutionPolicy, SequenceContainer>{},
+            detail::stable_sorter{});
+        return *this;
+    }
+
+    /**
+     * @brief Create a new seqence from the initial elements of this sequence
+     *
+     * @param[in] num - The number of elements to take from this sequence
+     * @return A new sequence from the taken elements
+     */
+    extended_sequence_container
+    take(typename SequenceContainer::difference_type num) const & {
+        return detail::make_rebound<extended_sequence_container>(
+            *this, this->begin(), std::next(this->begin(), num));
+    }
+
+    // When 'this' is a modifiable r-value, just erase in-place
+    extended_sequence_container
+    take(typename SequenceContainer::difference_type num) && {
+        detail::erase_from(*this, std::next(this->begin(), num), num);
+        return std::move(*this);
     }
 
     /**
@@ -367,14 +1126,16 @@ public:
     template <typename UnaryPredicate>
     extended_sequence_container take_while(UnaryPredicate p) const & {
         auto end = std::find_if_not(this->begin(), this->end(), p);
-        return {this->begin(), end};
+        return detail::make_rebound<extended_sequence_container>(
+            *this, this->begin(), end);
     }
 
     // When 'this' is a modifiable r-value, erase in-place
     template <typename UnaryPredicate>
     extended_sequence_container take_while(UnaryPredicate p) && {
         auto last = std::find_if_not(this->begin(), this->end(), p);
-        this->erase(last, this->end());
+        detail::erase_from(*this, last,
+                           std::distance(this->begin(), last));
         return std::move(*this);
     }
 
@@ -406,6 +1167,47 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Apply a function to each element of this container in-place,
+     * using the given execution policy
+     *
+     * @param[in] policy - The execution policy to use
+     * @param[in] f - The function to use to transform each element. Must be
+     *                safe to invoke concurrently
+     * @return A reference to this container (now modified)
+     */
+    template <typename ExecutionPolicy, typename UnaryFunction>
+    detail::enable_if_execution_policy<ExecutionPolicy,
+                                       extended_sequence_container&>
+    transform(ExecutionPolicy&&, UnaryFunction f) {
+        transform_helper(
+            f, detail::use_parallel<ExecutionPolicy, SequenceContainer>{});
+        return *this;
+    }
+
+    /**
+     * @brief Remove all but the first of each run of consecutive equal
+     * elements
+     *
+     * Lists unlink the nodes of the removed elements, rather than moving the
+     * elements that are kept.
+     *
+     * @code
+     * cec::vector<int> numbers = {1, 1, 2, 1, 3, 3};
+     * numbers.unique(); // {1, 2, 1, 3}
+     * @endcode
+     *
+     * @param[in] p - The predicate comparing consecutive elements
+     * @return A reference to this container
+     *
+     * \see To remove all duplicate elements: distinct()
+     */
+    template <typename BinaryPredicate = std::equal_to<value_type>>
+    extended_sequence_container& unique(BinaryPredicate p = BinaryPredicate()) {
+        unique_helper(p, detail::has_unique<SequenceContainer>{});
+        return *this;
+    }
+
     /**
      * @brief Transform this sequence of pairs in to a pair of sequences
      * @return A pair of sequences
@@ -423,21 +1225,88 @@ public:
      * @endcode
      */
     template <typename PairType = value_type>
-    unzip_t<PairType> unzip() const {
-        unzip_t<PairType> unzipped;
+    unzip_t<PairType> unzip() const & {
+        return unzip_helper<PairType>(*this);
+    }
+
+    // Move the elements of a temporary in to the result
+    template <typename PairType = value_type>
+    unzip_t<PairType> unzip() && {
+        return unzip_helper<PairType>(std::move(*this));
+    }
 
+    /**
+     * @brief Transform this sequence of pairs or tuples in to a soa_vector,
+     * storing each field in its own column
+     *
+     * Requires cec/soa_vector.hpp.
+     *
+     * @return A soa_vector holding the same rows
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<std::pair<int, float>> vec_of_pairs = {
+     *        {1, 5.0},
+     *        {2, 17.2}
+     *    };
+     *
+     *    // columns { {1, 2}, {5.0, 17.2} }
+     *    cec::soa_vector<int, float> soa = vec_of_pairs.unzip_soa();
+     * @endcode
+     */
+    template <typename RowType = value_type>
+    extended_sequence_container<typename detail::soa_of<RowType>::type>
+    unzip_soa() const {
+        extended_sequence_container<typename detail::soa_of<RowType>::type>
+            unzipped;
+        unzipped.reserve(detail::container_size(*this));
         for (const auto& item : *this) {
-            unzipped.first.emplace(unzipped.first.end(), item.first);
-            unzipped.second.emplace(unzipped.second.end(), item.second);
+            unzipped.emplace_back(item);
         }
-
         return unzipped;
     }
 
+    /**
+     * @brief Create a lazy view of this container
+     *
+     * Operations on the view (map, filter, take, take_while and zip) do not
+     * copy this container, and a chain of them is evaluated in a single pass
+     * when the view is iterated or materialized.
+     *
+     * @return A sequence_view of this container
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<std::string> lines = read_lines();
+     *
+     *    // Stops reading after the first ten errors
+     *    cec::vector<std::string> errors =
+     *        lines.view()
+     *            .filter([](const std::string& l) { return is_error(l); })
+     *            .take(10)
+     *            .to<cec::vector<std::string>>();
+     * @endcode
+     *
+     * \see sequence_view
+     */
+    sequence_view<typename SequenceContainer::const_iterator> view() const & {
+        return {this->begin(), this->end()};
+    }
+
+    sequence_view<typename SequenceContainer::iterator> view() & {
+        return {this->begin(), this->end()};
+    }
+
+    // A view of a temporary would immediately dangle
+    void view() && = delete;
+
     /**
      * @brief Create a sequence of the element-wise pairing of the container and
      * \a other
      *
+     * If this container or \a other is an rvalue, its elements are moved
+     * rather than copied.
+     *
      * @return A sequence of pairs
      *
      * Example Usage:
@@ -447,21 +1316,22 @@ public:
      *
      *    // contains { {1, 'a'}, {2, 'b'}, {3, 'c'} }
      *    cec::vector<std::pair<int, char>> zipped = left.zip(right);
+     *
+     *    // copies no elements
+     *    auto moved = std::move(left).zip(std::move(right));
      * @endcode
      */
     template <typename Container>
-    zip_t<Container> zip(const Container& other) const {
-        zip_t<Container> zipped;
-
-        auto first_iter = this->begin();
-        auto second_iter = other.begin();
-
-        for (; first_iter != this->end() && second_iter != other.end();
-             std::advance(first_iter, 1), std::advance(second_iter, 1)) {
-            zipped.emplace(zipped.end(), *first_iter, *second_iter);
-        }
+    zip_t<typename std::decay<Container>::type>
+    zip(Container&& other) const & {
+        return zip_helper(*this, std::forward<Container>(other));
+    }
 
-        return zipped;
+    // The elements of a temporary this container, or of a temporary
+    // \a other, are moved in to the result rather than copied
+    template <typename Container>
+    zip_t<typename std::decay<Container>::type> zip(Container&& other) && {
+        return zip_helper(std::move(*this), std::forward<Container>(other));
     }
 
     /**
@@ -471,42 +1341,869 @@ public:
      * Like \a zip but with an arbitrary number of containers. The return type
      * \a zip_n_t will be an extended container of \a T with the first parameter
      * rebound to a tuple of the value_type of this container and each container
-     * in \a containers.
+     * in \a containers. As for \a zip, the elements of temporaries are moved.
      *
      * @return A sequence of tuples
      */
     template <typename... Containers>
-    zip_n_t<Containers...> zip_n(const Containers&... containers) const {
-        zip_n_t<Containers...> zipped;
+    zip_n_t<typename std::decay<Containers>::type...>
+    zip_n(Containers&&... containers) const & {
+        return zip_n_helper(*this, std::forward<Containers>(containers)...);
+    }
+
+    template <typename... Containers>
+    zip_n_t<typename std::decay<Containers>::type...>
+    zip_n(Containers&&... containers) && {
+        return zip_n_helper(std::move(*this),
+                            std::forward<Containers>(containers)...);
+    }
+
+    /**
+     * @brief Create a lazy view of the element-wise tuples of this container
+     * and \a containers
+     *
+     * Unlike \a zip_n, nothing is copied: the view yields tuples of
+     * references to the elements of each container (so writing through
+     * them modifies the containers), walks each container once, and ends
+     * when any of them is exhausted. The view is random access if all of
+     * the containers are.
+     *
+     * @param[in] containers - The containers to zip with. They must outlive
+     *                         the view.
+     * @return A sequence_view of tuples of references
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<int> ids = {1, 2, 3};
+     *    cec::list<std::string> names = {"a", "b"};
+     *
+     *    // visits {1, "a"} and {2, "b"}
+     *    for (auto row : ids.zip_n_view(names)) {
+     *        std::get<1>(row) += std::to_string(std::get<0>(row));
+     *    }
+     *    // names == {"a1", "b2"}
+     * @endcode
+     *
+     * \see sequence_view
+     */
+    template <typename... Containers>
+    zip_view_t<typename SequenceContainer::const_iterator, Containers...>
+    zip_n_view(Containers&... containers) const & {
+        return detail::make_zip_view(
+            std::make_tuple(this->begin(), std::begin(containers)...),
+            std::make_tuple(this->end(), std::end(containers)...));
+    }
+
+    template <typename... Containers>
+    zip_view_t<typename SequenceContainer::iterator, Containers...>
+    zip_n_view(Containers&... containers) & {
+        return detail::make_zip_view(
+            std::make_tuple(this->begin(), std::begin(containers)...),
+            std::make_tuple(this->end(), std::end(containers)...));
+    }
+
+    // A view of a temporary would immediately dangle
+    template <typename... Containers>
+    void zip_n_view(Containers&...) && = delete;
+
+    /**
+     * @brief Like \a zip_n, but producing a soa_vector with a column for
+     * this container and for each of \a containers
+     *
+     * Requires cec/soa_vector.hpp.
+     *
+     * @return A soa_vector of the element-wise rows
+     *
+     * Example Usage:
+     * @code
+     *    cec::vector<int> ids = {1, 2, 3};
+     *    cec::vector<std::string> names = {"a", "b"};
+     *
+     *    // columns { {1, 2}, {"a", "b"} }
+     *    cec::soa_vector<int, std::string> rows = ids.zip_soa(names);
+     * @endcode
+     */
+    template <typename... Containers>
+    extended_sequence_container<
+        basic_soa_vector<value_type, typename Containers::value_type...>>
+    zip_soa(const Containers&... containers) const {
+        extended_sequence_container<
+            basic_soa_vector<value_type, typename Containers::value_type...>>
+            zipped;
 
-        // FIXME this is just generally bad
         std::array<std::size_t, sizeof...(Containers) + 1> sizes =
-            {detail::container_size(*this),
-             detail::container_size(containers)...};
+            {static_cast<std::size_t>(detail::container_size(*this)),
+             static_cast<std::size_t>(detail::container_size(containers))...};
 
         auto smallest = *std::min_element(sizes.begin(), sizes.end());
+        zipped.reserve(smallest);
         auto iter_tuple =
             std::make_tuple(this->begin(), std::begin(containers)...);
 
         for (std::size_t i = 0; i < smallest; ++i) {
-            zipped.emplace(zipped.end(),
-                           detail::get_iter_tuple_value(iter_tuple));
+            zipped.emplace_back(detail::get_iter_tuple_value(iter_tuple));
             detail::advance_iter_tuple(iter_tuple);
         }
 
         return zipped;
     }
 
+    /**
+     * @brief Create a lazy view of the element-wise pairing of this
+     * container and \a other
+     *
+     * Equivalent to zip_n_view(other): the view yields tuples of references
+     * rather than copying pairs.
+     *
+     * \see zip_n_view
+     */
+    template <typename Container>
+    zip_view_t<typename SequenceContainer::const_iterator, Container>
+    zip_view(Container& other) const & {
+        return zip_n_view(other);
+    }
+
+    template <typename Container>
+    zip_view_t<typename SequenceContainer::iterator, Container>
+    zip_view(Container& other) & {
+        return zip_n_view(other);
+    }
+
+    template <typename Container>
+    void zip_view(Container&) && = delete;
+
 private:
+    template <typename T>
+    bool contains_serial(const T& value, detail::search_elements) const {
+        return std::find(this->begin(), this->end(), value) != this->end();
+    }
+
+    // Contiguous arithmetic elements are searched with the vector kernels,
+    // once 'value' is converted to an element. If it does not survive the
+    // conversion, it cannot be equal to any element that does.
+    template <typename T>
+    bool contains_serial(const T& value, detail::search_values) const {
+        auto element = static_cast<value_type>(value);
+        if (static_cast<T>(element) != value) {
+            return contains_serial(value, detail::search_elements{});
+        }
+        auto first = this->data();
+        auto last = first + this->size();
+        return detail::find_value(first, last, element) != last;
+    }
+
+    template <typename T>
+    bool contains_serial(const T& value, detail::search_substring) const {
+        return detail::contains_substring(*this, value, 0);
+    }
+
+    typename SequenceContainer::difference_type
+    count_serial(const value_type& value, std::false_type) const {
+        return std::count(this->begin(), this->end(), value);
+    }
+
+    typename SequenceContainer::difference_type
+    count_serial(const value_type& value, std::true_type) const {
+        return static_cast<typename SequenceContainer::difference_type>(
+            detail::count_value(this->data(), this->size(), value));
+    }
+
+    template <typename UnaryPredicate>
+    typename SequenceContainer::difference_type
+    count_if_serial(UnaryPredicate& p, std::false_type) const {
+        return std::count_if(this->begin(), this->end(), p);
+    }
+
+    // Contiguous arithmetic elements are counted without branching on the
+    // predicate
+    template <typename UnaryPredicate>
+    typename SequenceContainer::difference_type
+    count_if_serial(UnaryPredicate& p, std::true_type) const {
+        return static_cast<typename SequenceContainer::difference_type>(
+            detail::count_if_contiguous(this->data(), this->size(), p));
+    }
+
+    template <typename T>
+    bool contains_helper(const T& value, std::false_type) const {
+        return contains(value);
+    }
+
+    template <typename T>
+    bool contains_helper(const T& value, std::true_type) const {
+        std::atomic<bool> found(false);
+        auto first = this->begin();
+        auto size = this->size();
+        detail::parallel_for_chunks(
+            size, detail::parallel_chunk_count(size),
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                // Search in small blocks, so that every chunk can stop soon
+                // after the value is found
+                while (begin != end && !found) {
+                    auto block_end =
+                        std::min(end, begin + detail::parallel_grain_size);
+                    auto block_last = std::next(first, block_end);
+                    if (std::find(std::next(first, begin), block_last, value) !=
+                        block_last) {
+                        found = true;
+                    }
+                    begin = block_end;
+                }
+            });
+        return found;
+    }
+
+    template <typename UnaryPredicate>
+    typename SequenceContainer::difference_type
+    count_if_helper(UnaryPredicate& p, std::false_type) const {
+        return count_if(p);
+    }
+
+    template <typename UnaryPredicate>
+    typename SequenceContainer::difference_type
+    count_if_helper(UnaryPredicate& p, std::true_type) const {
+        auto first = this->begin();
+        auto size = this->size();
+        auto chunks = detail::parallel_chunk_count(size);
+
+        std::vector<typename SequenceContainer::difference_type> counts(chunks);
+        detail::parallel_for_chunks(
+            size, chunks,
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                counts[chunk] = std::count_if(std::next(first, begin),
+                                              std::next(first, end), p);
+            });
+        return std::accumulate(counts.begin(), counts.end(),
+                               typename SequenceContainer::difference_type{});
+    }
+
+    template <typename UnaryPredicate>
+    void erase_if_serial(UnaryPredicate& p, std::false_type) {
+        remove_if_helper(p, detail::has_remove_if<SequenceContainer>{});
+    }
+
+    template <typename UnaryPredicate>
+    void remove_if_helper(UnaryPredicate& p, std::false_type) {
+        this->erase(std::remove_if(this->begin(), this->end(), p), this->end());
+    }
+
+    template <typename UnaryPredicate>
+    void remove_if_helper(UnaryPredicate& p, std::true_type) {
+        SequenceContainer::remove_if(
+            [&p](const value_type& v) { return p(v); });
+    }
+
+    void erase_all_helper(const value_type& value, std::false_type) {
+        this->erase(std::remove(this->begin(), this->end(), value),
+                    this->end());
+    }
+
+    void erase_all_helper(const value_type& value, std::true_type) {
+        SequenceContainer::remove(value);
+    }
+
+    // The first occurrences are moved to the front. Only the elements before
+    // 'kept' are referred to by 'seen', and they are not modified again.
+    void distinct_helper(std::false_type) {
+        detail::indirect_hash_set<value_type> seen;
+        auto kept = this->begin();
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            if (kept != it) {
+                *kept = std::move(*it);
+            }
+            if (seen.insert(&*kept)) {
+                ++kept;
+            }
+        }
+        this->erase(kept, this->end());
+    }
+
+    // The kept elements do not move when the duplicates are unlinked, so
+    // 'seen' can refer to them
+    void distinct_helper(std::true_type) {
+        detail::indirect_hash_set<value_type> seen;
+        SequenceContainer::remove_if(
+            [&seen](const value_type& v) { return !seen.insert(&v); });
+    }
+
+    void extend_helper(extended_sequence_container& other, std::false_type) {
+        detail::make_appender(*this).insert(
+            std::make_move_iterator(other.begin()),
+            std::make_move_iterator(other.end()));
+    }
+
+    // Nodes can only be relinked between lists with equal allocators
+    void extend_helper(extended_sequence_container& other, std::true_type) {
+        if (this->get_allocator() == other.get_allocator()) {
+            this->splice(this->end(), other);
+        } else {
+            extend_helper(other, std::false_type{});
+        }
+    }
+
+    template <typename Compare>
+    void merge_helper(extended_sequence_container& other, Compare& comp,
+                      std::false_type) {
+        auto middle = detail::container_size(*this);
+        extend_helper(other, std::false_type{});
+        other.clear();
+        std::inplace_merge(this->begin(), std::next(this->begin(), middle),
+                           this->end(), comp);
+    }
+
+    // Nodes can only be relinked between lists with equal allocators, so
+    // otherwise the elements of 'other' are first moved in to a list
+    // sharing this one's allocator
+    template <typename Compare>
+    void merge_helper(extended_sequence_container& other, Compare& comp,
+                      std::true_type) {
+        if (this->get_allocator() == other.get_allocator()) {
+            SequenceContainer::merge(other, comp);
+        } else {
+            auto moved =
+                detail::make_rebound<extended_sequence_container>(*this);
+            auto append = detail::make_appender(moved);
+            detail::append_range(append, std::move(other));
+            other.clear();
+            SequenceContainer::merge(moved, comp);
+        }
+    }
+
+    void reverse_helper(std::false_type) {
+        std::reverse(this->begin(), this->end());
+    }
+
+    void reverse_helper(std::true_type) { SequenceContainer::reverse(); }
+
+    template <typename BinaryPredicate>
+    void unique_helper(BinaryPredicate& p, std::false_type) {
+        this->erase(std::unique(this->begin(), this->end(), p), this->end());
+    }
+
+    template <typename BinaryPredicate>
+    void unique_helper(BinaryPredicate& p, std::true_type) {
+        SequenceContainer::unique(p);
+    }
+
+    // Contiguous arithmetic elements are compacted in-place without
+    // branching on the predicate
+    template <typename UnaryPredicate>
+    void erase_if_serial(UnaryPredicate& p, std::true_type) {
+        if (this->empty()) {
+            return;
+        }
+        auto data = &*this->begin();
+        auto keep = [&p](const value_type& v) { return !p(v); };
+        auto kept = detail::compact(data, this->size(), data, keep);
+        this->erase(std::next(this->begin(), kept), this->end());
+    }
+
+    template <typename UnaryPredicate>
+    void erase_if_helper(UnaryPredicate& p, std::false_type) {
+        erase_if(p);
+    }
+
+    // Each chunk is compacted in parallel, then the surviving prefixes of
+    // each chunk are moved together
+    template <typename UnaryPredicate>
+    void erase_if_helper(UnaryPredicate& p, std::true_type) {
+        auto first = this->begin();
+        auto size = this->size();
+        auto chunks = detail::parallel_chunk_count(size);
+
+        std::vector<std::size_t> kept(chunks);
+        detail::parallel_for_chunks(
+            size, chunks,
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                auto chunk_first = std::next(first, begin);
+                kept[chunk] = std::distance(
+                    chunk_first,
+                    std::remove_if(chunk_first, std::next(first, end), p));
+            });
+
+        auto out = std::next(first, kept[0]);
+        for (std::size_t chunk = 1; chunk < chunks; ++chunk) {
+            auto chunk_first =
+                std::next(first, detail::chunk_begin(size, chunks, chunk));
+            out = std::move(chunk_first, std::next(chunk_first, kept[chunk]),
+                            out);
+        }
+        this->erase(out, this->end());
+    }
+
+    template <typename UnaryPredicate>
+    void filter_into(extended_sequence_container& filtered, UnaryPredicate& p,
+                     std::false_type) const {
+        auto append = detail::make_appender(filtered);
+        for (const auto& item : *this) {
+            if (p(item)) {
+                append.emplace(item);
+            }
+        }
+    }
+
+    // Contiguous arithmetic elements are compacted without branching on the
+    // predicate
+    template <typename UnaryPredicate>
+    void filter_into(extended_sequence_container& filtered, UnaryPredicate& p,
+                     std::true_type) const {
+        detail::compact_append(filtered, this->data(), this->size(), p);
+    }
+
+    // Satisfying elements are compacted to the front, as by remove_if
+    template <typename UnaryPredicate>
+    void partition_helper(extended_sequence_container& rest, UnaryPredicate& p,
+                          std::false_type) {
+        auto append = detail::make_appender(rest);
+        auto kept = this->begin();
+        std::size_t kept_count = 0;
+        for (auto it = this->begin(); it != this->end(); ++it) {
+            if (p(*it)) {
+                if (kept != it) {
+                    *kept = std::move(*it);
+                }
+                ++kept;
+                ++kept_count;
+            } else {
+                append.emplace(std::move(*it));
+            }
+        }
+        detail::erase_from(*this, kept, kept_count);
+    }
+
+    // Nodes can only be relinked between lists with equal allocators, and
+    // 'rest' may have been given another (e.g., that of an arena)
+    template <typename UnaryPredicate>
+    void partition_helper(extended_sequence_container& rest, UnaryPredicate& p,
+                          std::true_type) {
+        if (rest.get_allocator() != this->get_allocator()) {
+            partition_helper(rest, p, std::false_type{});
+            return;
+        }
+        for (auto it = this->begin(); it != this->end();) {
+            if (p(*it)) {
+                ++it;
+            } else {
+                rest.splice(rest.end(), *this, it++);
+            }
+        }
+    }
+
+    // Without reserve(), elements are appended to their groups as they are
+    // found. Each key maps to the appender for its group, as forward_lists
+    // track their last element to append in constant time.
+    template <typename Self, typename KeyFunction>
+    static auto group_by_helper(Self&& self, KeyFunction& key, std::false_type)
+        -> group_by_t<decltype(key(*self.begin()))> {
+        using key_type =
+            typename std::decay<decltype(key(*self.begin()))>::type;
+        using appender_type = detail::appender<extended_sequence_container>;
+
+        group_by_t<key_type> groups;
+        std::unordered_map<key_type, appender_type> appenders;
+        for (auto&& item : self) {
+            auto item_key = key(item);
+            auto group = appenders.find(item_key);
+            if (group == appenders.end()) {
+                auto empty =
+                    detail::make_rebound<extended_sequence_container>(self);
+                auto& grouped =
+                    groups.emplace(item_key, std::move(empty)).first->second;
+                group = appenders
+                            .emplace(std::move(item_key),
+                                     appender_type(grouped))
+                            .first;
+            }
+            group->second.emplace(detail::forward_like<Self>(item));
+        }
+        return groups;
+    }
+
+    // With reserve(), the group of each element is found first (computing
+    // each key once), so that every group can be allocated for its final
+    // size before the elements are distributed
+    template <typename Self, typename KeyFunction>
+    static auto group_by_helper(Self&& self, KeyFunction& key, std::true_type)
+        -> group_by_t<decltype(key(*self.begin()))> {
+        using key_type =
+            typename std::decay<decltype(key(*self.begin()))>::type;
+
+        std::unordered_map<key_type, std::size_t> indexes;
+        std::vector<std::size_t> element_groups;
+        std::vector<std::size_t> sizes;
+        element_groups.reserve(self.size());
+        for (const auto& item : self) {
+            auto item_key = key(item);
+            auto index = indexes.find(item_key);
+            if (index == indexes.end()) {
+                index =
+                    indexes.emplace(std::move(item_key), sizes.size()).first;
+                sizes.push_back(0);
+            }
+            ++sizes[index->second];
+            element_groups.push_back(index->second);
+        }
+
+        std::vector<extended_sequence_container> grouped;
+        grouped.reserve(sizes.size());
+        for (auto size : sizes) {
+            grouped.push_back(
+                detail::make_rebound<extended_sequence_container>(self));
+            grouped.back().reserve(size);
+        }
+        auto element_group = element_groups.begin();
+        for (auto&& item : self) {
+            detail::make_appender(grouped[*element_group++])
+                .emplace(detail::forward_like<Self>(item));
+        }
+
+        group_by_t<key_type> groups(indexes.size());
+        for (const auto& index : indexes) {
+            groups.emplace(index.first, std::move(grouped[index.second]));
+        }
+        return groups;
+    }
+
+    template <typename Container>
+    void flatten_helper(Container& flattened, std::false_type) {
+        detail::reserve_hint(
+            flattened, [this] { return detail::nested_container_size(*this); });
+
+        auto append = detail::make_appender(flattened);
+        for (auto&& innerContainer : *this) {
+            detail::append_range(append, std::move(innerContainer));
+        }
+    }
+
+    // Nodes can only be relinked between lists with equal allocators
+    template <typename Container>
+    void flatten_helper(Container& flattened, std::true_type) {
+        for (auto& innerContainer : *this) {
+            if (innerContainer.get_allocator() == flattened.get_allocator()) {
+                flattened.splice(flattened.end(), innerContainer);
+            } else {
+                detail::make_appender(flattened).insert(
+                    std::make_move_iterator(innerContainer.begin()),
+                    std::make_move_iterator(innerContainer.end()));
+            }
+        }
+    }
+
+    template <typename UnaryPredicate>
+    extended_sequence_container filter_helper(UnaryPredicate& p,
+                                              std::false_type) const {
+        return filter(p);
+    }
+
+    // The predicate is evaluated in parallel, recording which elements are
+    // kept. The survivors are then copied to their final positions.
+    template <typename UnaryPredicate>
+    extended_sequence_container filter_helper(UnaryPredicate& p,
+                                              std::true_type) const {
+        auto first = this->begin();
+        auto size = this->size();
+        auto chunks = detail::parallel_chunk_count(size);
+
+        std::vector<char> keep(size);
+        std::vector<std::size_t> offsets(chunks + 1);
+        detail::parallel_for_chunks(
+            size, chunks,
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                std::size_t kept = 0;
+                for (auto iter = std::next(first, begin); begin != end;
+                     ++begin, ++iter) {
+                    keep[begin] = p(*iter) ? 1 : 0;
+                    kept += keep[begin];
+                }
+                offsets[chunk + 1] = kept;
+            });
+        std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+        auto filtered =
+            detail::make_rebound<extended_sequence_container>(*this);
+        fill_filtered(
+            filtered, keep, offsets,
+            std::is_default_constructible<value_type>{});
+        return filtered;
+    }
+
+    // If elements can be default constructed, the output is sized up front
+    // and each chunk copies its survivors in parallel
+    void fill_filtered(extended_sequence_container& filtered,
+                       const std::vector<char>& keep,
+                       const std::vector<std::size_t>& offsets,
+                       std::true_type) const {
+        auto first = this->begin();
+        auto chunks = offsets.size() - 1;
+
+        filtered.resize(offsets.back());
+        auto out_first = filtered.begin();
+        detail::parallel_for_chunks(
+            keep.size(), chunks,
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                auto out = std::next(out_first, offsets[chunk]);
+                for (auto iter = std::next(first, begin); begin != end;
+                     ++begin, ++iter) {
+                    if (keep[begin]) {
+                        *out = *iter;
+                        ++out;
+                    }
+                }
+            });
+    }
+
+    void fill_filtered(extended_sequence_container& filtered,
+                       const std::vector<char>& keep,
+                       const std::vector<std::size_t>& offsets,
+                       std::false_type) const {
+        detail::reserve_hint(filtered, [&] { return offsets.back(); });
+        auto append = detail::make_appender(filtered);
+        auto iter = this->begin();
+        for (std::size_t i = 0; i < keep.size(); ++i, ++iter) {
+            if (keep[i]) {
+                append.emplace(*iter);
+            }
+        }
+    }
+
+    template <typename UnaryFunction>
+    auto map_helper(UnaryFunction& f, std::false_type) const
+        -> rebind_as_extended_container<decltype(f(*this->begin()))> {
+        return map(f);
+    }
+
+    template <typename UnaryFunction>
+    auto map_helper(UnaryFunction& f, std::true_type) const
+        -> rebind_as_extended_container<decltype(f(*this->begin()))> {
+        using mapped_t =
+            rebind_as_extended_container<decltype(f(*this->begin()))>;
+        using result_t = typename mapped_t::value_type;
+
+        auto mapped = detail::make_rebound<mapped_t>(*this);
+        map_into(mapped, f,
+                 std::integral_constant<
+                     bool, std::is_default_constructible<result_t>::value &&
+                               detail::is_random_access<mapped_t>::value>{});
+        return mapped;
+    }
+
+    // If the mapped container can be sized up front, each chunk writes its
+    // results directly in to place
+    template <typename Mapped, typename UnaryFunction>
+    void map_into(Mapped& mapped, UnaryFunction& f, std::true_type) const {
+        auto first = this->begin();
+        auto size = this->size();
+
+        mapped.resize(size);
+        auto out_first = mapped.begin();
+        detail::parallel_for_chunks(
+            size, detail::parallel_chunk_count(size),
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                auto out = std::next(out_first, begin);
+                for (auto iter = std::next(first, begin); begin != end;
+                     ++begin, ++iter, ++out) {
+                    *out = f(*iter);
+                }
+            });
+    }
+
+    // Otherwise, each chunk is mapped in to a separate container, and the
+    // results are moved in to the final container in order
+    template <typename Mapped, typename UnaryFunction>
+    void map_into(Mapped& mapped, UnaryFunction& f, std::false_type) const {
+        auto first = this->begin();
+        auto size = this->size();
+        auto chunks = detail::parallel_chunk_count(size);
+
+        std::vector<Mapped> partials;
+        partials.reserve(chunks);
+        for (std::size_t i = 0; i < chunks; ++i) {
+            partials.push_back(detail::make_rebound<Mapped>(*this));
+        }
+        detail::parallel_for_chunks(
+            size, chunks,
+            [&](std::size_t chunk, std::size_t begin, std::size_t end) {
+                detail::reserve_hint(partials[chunk],
+                                     [&] { return end - begin; });
+                auto append = detail::make_appender(partials[chunk]);
+                for (auto iter = std::next(first, begin); begin != end;
+                     ++begin, ++iter) {
+                    append.emplace(f(*iter));
+                }
+            });
+
+        detail::reserve_hint(mapped, [size] { return size; });
+        auto append = detail::make_appender(mapped);
+        for (auto& partial : partials) {
+            detail::append_range(append, std::move(partial));
+        }
+    }
+
+    template <typename UnaryFunction>
+    void transform_helper(UnaryFunction& f, std::false_type) {
+        transform(f);
+    }
+
+    template <typename UnaryFunction>
+    void transform_helper(UnaryFunction& f, std::true_type) {
+        auto first = this->begin();
+        auto size = this->size();
+        detail::parallel_for_chunks(
+            size, detail::parallel_chunk_count(size),
+            [&](std::size_t, std::size_t begin, std::size_t end) {
+                for (auto iter = std::next(first, begin); begin != end;
+                     ++begin, ++iter) {
+                    *iter = f(std::move(*iter));
+                }
+            });
+    }
+
     template <typename Compare>
     void sort_helper(Compare comp, std::true_type) {
-        std::sort(this->begin(), this->end(), comp);
+        detail::unstable_sorter{}(this->begin(), this->end(), comp);
     }
 
     template <typename Compare>
     void sort_helper(Compare comp, std::false_type) {
         SequenceContainer::sort(comp);
     }
+
+    template <typename Compare, typename Sorter>
+    void parallel_sort_helper(Compare& comp, std::true_type, Sorter sorter) {
+        detail::parallel_merge_sort(this->begin(), this->end(), comp, sorter);
+    }
+
+    // Serially, random access containers are sorted as a single chunk.
+    // Others use their member sort function, which is stable, so serves for
+    // both sort and stable_sort.
+    template <typename Compare, typename Sorter>
+    void parallel_sort_helper(Compare& comp, std::false_type, Sorter sorter) {
+        serial_sort_helper(comp, sorter,
+                           typename detail::is_random_access<
+                               SequenceContainer>::type{});
+    }
+
+    template <typename Compare, typename Sorter>
+    void serial_sort_helper(Compare& comp, Sorter sorter, std::true_type) {
+        sorter(this->begin(), this->end(), comp);
+    }
+
+    template <typename Compare, typename Sorter>
+    void serial_sort_helper(Compare& comp, Sorter, std::false_type) {
+        SequenceContainer::sort(comp);
+    }
+
+    template <typename KeyFunction>
+    void sort_by_helper(KeyFunction& key, std::true_type) {
+        using key_type =
+            typename std::decay<decltype(key(*this->begin()))>::type;
+        detail::sort_by_dispatch(this->begin(), this->end(), key,
+                                 detail::is_radix_key<key_type>{});
+    }
+
+    template <typename KeyFunction>
+    void sort_by_helper(KeyFunction& key, std::false_type) {
+        SequenceContainer::sort(
+            [&key](const value_type& lhs, const value_type& rhs) {
+                return key(lhs) < key(rhs);
+            });
+    }
+
+    template <typename Compare>
+    void stable_sort_helper(Compare comp, std::true_type) {
+        detail::stable_sorter{}(this->begin(), this->end(), comp);
+    }
+
+    template <typename Compare>
+    void stable_sort_helper(Compare comp, std::false_type) {
+        SequenceContainer::sort(comp);
+    }
+
+    template <typename PairType, typename Self>
+    static unzip_t<PairType> unzip_helper(Self&& self) {
+        unzip_t<PairType> unzipped(
+            detail::make_rebound<typename unzip_t<PairType>::first_type>(
+                self),
+            detail::make_rebound<typename unzip_t<PairType>::second_type>(
+                self));
+        auto size = [&self] { return detail::container_size(self); };
+        detail::reserve_hint(unzipped.first, size);
+        detail::reserve_hint(unzipped.second, size);
+
+        auto append_first = detail::make_appender(unzipped.first);
+        auto append_second = detail::make_appender(unzipped.second);
+        for (auto&& item : self) {
+            append_first.emplace(detail::forward_like<Self>(item).first);
+            append_second.emplace(detail::forward_like<Self>(item).second);
+        }
+
+        return unzipped;
+    }
+
+    template <typename Self, typename Container>
+    static zip_t<typename std::decay<Container>::type>
+    zip_helper(Self&& self, Container&& other) {
+        auto zipped =
+            detail::make_rebound<zip_t<typename std::decay<Container>::type>>(
+                self);
+        detail::reserve_hint(zipped, [&] {
+            return std::min<std::size_t>(detail::container_size(self),
+                                         detail::container_size(other));
+        });
+
+        auto append = detail::make_appender(zipped);
+        auto first_iter = self.begin();
+        auto second_iter = other.begin();
+
+        for (; first_iter != self.end() && second_iter != other.end();
+             std::advance(first_iter, 1), std::advance(second_iter, 1)) {
+            append.emplace(detail::forward_like<Self>(*first_iter),
+                           detail::forward_like<Container>(*second_iter));
+        }
+
+        return zipped;
+    }
+
+    template <typename Self, typename... Containers>
+    static zip_n_t<typename std::decay<Containers>::type...>
+    zip_n_helper(Self&& self, Containers&&... containers) {
+        auto zipped = detail::make_rebound<
+            zip_n_t<typename std::decay<Containers>::type...>>(self);
+
+        // FIXME this is just generally bad
+        std::array<std::size_t, sizeof...(Containers) + 1> sizes =
+            {static_cast<std::size_t>(detail::container_size(self)),
+             static_cast<std::size_t>(detail::container_size(containers))...};
+
+        auto smallest = *std::min_element(sizes.begin(), sizes.end());
+        detail::reserve_hint(zipped, [smallest] { return smallest; });
+        auto append = detail::make_appender(zipped);
+        auto iter_tuple =
+            std::make_tuple(self.begin(), std::begin(containers)...);
+
+        for (std::size_t i = 0; i < smallest; ++i) {
+            zip_n_emplace<Self, Containers...>(
+                append, iter_tuple,
+                detail::make_index_pack<sizeof...(Containers) + 1>());
+            detail::advance_iter_tuple(iter_tuple);
+        }
+
+        return zipped;
+    }
+
+    // Emplace the tuple of the elements at 'iter_tuple', moving those of
+    // containers which are rvalues
+    template <typename... Sources, typename Zipped, typename IterTuple,
+              std::size_t... Indexes>
+    static void zip_n_emplace(detail::appender<Zipped>& zipped,
+                              const IterTuple& iter_tuple,
+                              detail::index_pack<Indexes...>) {
+        using sources = std::tuple<Sources...>;
+        zipped.emplace(
+            typename Zipped::value_type(
+                detail::forward_like<
+                    typename std::tuple_element<Indexes, sources>::type>(
+                    *std::get<Indexes>(iter_tuple))...));
+    }
 };
 } // end cec
 
@@ -4,6 +4,10 @@
 #include <forward_list>
 #include <cec/extended_sequence_container.hpp>
 
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
+
 namespace cec {
 
 /**
@@ -12,6 +16,18 @@ namespace cec {
 template <typename T, typename Allocator = std::allocator<T>>
 using forward_list =
     cec::extended_sequence_container<std::forward_list<T, Allocator>>;
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+namespace pmr {
+
+/**
+ * @brief A convenience alias for extended std::forward_list using a polymorphic
+ * allocator
+ */
+template <typename T>
+using forward_list = cec::forward_list<T, std::pmr::polymorphic_allocator<T>>;
+}
+#endif
 }
 
 #endif
@@ -4,6 +4,10 @@
 #include <list>
 #include <cec/extended_sequence_container.hpp>
 
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
+
 namespace cec {
 
 /**
@@ -11,6 +15,18 @@ namespace cec {
  */
 template <typename T, typename Allocator = std::allocator<T>>
 using list = cec::extended_sequence_container<std::list<T, Allocator>>;
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+namespace pmr {
+
+/**
+ * @brief A convenience alias for extended std::list using a polymorphic
+ * allocator
+ */
+template <typename T>
+using list = cec::list<T, std::pmr::polymorphic_allocator<T>>;
+}
+#endif
 }
 
 #endif
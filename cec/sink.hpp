@@ -0,0 +1,60 @@
+#ifndef CEC_SINK
+#define CEC_SINK
+
+#include <utility>
+#include <cec/detail/extended_sequence_container.hpp>
+
+namespace cec {
+
+/**
+ * @brief Appends elements to the end of a container
+ *
+ * A sink is what the function given to flat_map() receives to emit its
+ * results, so that it may produce any number of elements without building
+ * a container of its own for each call.
+ *
+ * Example Usage:
+ * @code
+ *    cec::vector<int> numbers = {1, 2, 3};
+ *    auto repeated = numbers.flat_map<int>(
+ *        [](int i, cec::sink<cec::vector<int>>& out) {
+ *            for (int n = 0; n < i; ++n) {
+ *                out(i);
+ *            }
+ *        });
+ *    // repeated == {1, 2, 2, 3, 3, 3}
+ * @endcode
+ */
+template <typename Container>
+class sink {
+public:
+    /// The type of the elements appended
+    using value_type = typename Container::value_type;
+
+    /**
+     * @brief Create a sink appending to \a container
+     */
+    explicit sink(Container& container) : appender_(container) {}
+
+    /**
+     * @brief Append \a value
+     */
+    void operator()(const value_type& value) { emplace(value); }
+
+    // Move \a value in to the container
+    void operator()(value_type&& value) { emplace(std::move(value)); }
+
+    /**
+     * @brief Append an element constructed from \a args
+     */
+    template <typename... Args>
+    void emplace(Args&&... args) {
+        appender_.emplace(std::forward<Args>(args)...);
+    }
+
+private:
+    detail::appender<Container> appender_;
+};
+}
+
+#endif
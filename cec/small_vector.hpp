@@ -0,0 +1,532 @@
+#ifndef CEC_SMALL_VECTOR
+#define CEC_SMALL_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <cec/extended_sequence_container.hpp>
+
+namespace cec {
+
+/**
+ * @brief A vector which stores up to \a N elements within itself
+ *
+ * Until it holds more than \a N elements, a basic_small_vector does not
+ * allocate. Beyond that, elements are moved to the heap (using
+ * \a Allocator) and it behaves like \a std::vector. This makes it suitable
+ * for the many short sequences produced by e.g., split() and zip() on small
+ * inputs.
+ *
+ * Like extendable_basic_string, this type is not itself an extended
+ * container. Use cec::small_vector, which is.
+ *
+ * Iterators, pointers and references are invalidated by any operation which
+ * changes the capacity, as for \a std::vector. Unlike \a std::vector, moving
+ * a basic_small_vector holding its elements inline moves each element, and
+ * so also invalidates them.
+ */
+template <typename T, std::size_t N, typename Allocator = std::allocator<T>>
+class basic_small_vector {
+    static_assert(N > 0, "basic_small_vector requires inline capacity");
+
+    using alloc_traits = std::allocator_traits<Allocator>;
+
+public:
+    using value_type = T;
+    using allocator_type = Allocator;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using iterator = T*;
+    using const_iterator = const T*;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// Rebinding keeps the inline capacity, so map() and friends produce
+    /// small vectors of the same size
+    template <typename Rebind>
+    using other = basic_small_vector<
+        Rebind, N, typename alloc_traits::template rebind_alloc<Rebind>>;
+
+    /// The number of elements stored without allocating
+    static constexpr size_type inline_capacity = N;
+
+    basic_small_vector() : basic_small_vector(Allocator()) {}
+
+    explicit basic_small_vector(const Allocator& alloc)
+        : data_(inline_data()), size_(0), capacity_(N), alloc_(alloc) {}
+
+    explicit basic_small_vector(size_type count,
+                                const Allocator& alloc = Allocator())
+        : basic_small_vector(alloc) {
+        resize(count);
+    }
+
+    basic_small_vector(size_type count, const T& value,
+                       const Allocator& alloc = Allocator())
+        : basic_small_vector(alloc) {
+        assign(count, value);
+    }
+
+    template <typename InputIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<InputIterator>::value>::type>
+    basic_small_vector(InputIterator first, InputIterator last,
+                       const Allocator& alloc = Allocator())
+        : basic_small_vector(alloc) {
+        assign(first, last);
+    }
+
+    basic_small_vector(std::initializer_list<T> init,
+                       const Allocator& alloc = Allocator())
+        : basic_small_vector(init.begin(), init.end(), alloc) {}
+
+    basic_small_vector(const basic_small_vector& other)
+        : basic_small_vector(
+              other.begin(), other.end(),
+              alloc_traits::select_on_container_copy_construction(
+                  other.alloc_)) {}
+
+    basic_small_vector(const basic_small_vector& other, const Allocator& alloc)
+        : basic_small_vector(other.begin(), other.end(), alloc) {}
+
+    // The allocator is copied rather than moved, as a moved from allocator
+    // need not compare equal to its copies, and take_from only takes over a
+    // heap buffer (without allocating) if the allocators are equal
+    basic_small_vector(basic_small_vector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value)
+        : basic_small_vector(other.alloc_) {
+        take_from(other);
+    }
+
+    basic_small_vector(basic_small_vector&& other, const Allocator& alloc)
+        : basic_small_vector(alloc) {
+        take_from(other);
+    }
+
+    ~basic_small_vector() {
+        clear();
+        release();
+    }
+
+    basic_small_vector& operator=(const basic_small_vector& other) {
+        if (this != &other) {
+            assign(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    // Elements held in a heap buffer are taken over only if the allocators
+    // are equal, which (short of is_always_equal in C++17) is known of
+    // stateless allocators. Otherwise they are moved, which may allocate.
+    basic_small_vector& operator=(basic_small_vector&& other) noexcept(
+        std::is_nothrow_move_constructible<T>::value &&
+        std::is_empty<Allocator>::value) {
+        if (this != &other) {
+            clear();
+            take_from(other);
+        }
+        return *this;
+    }
+
+    basic_small_vector& operator=(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+        return *this;
+    }
+
+    void assign(size_type count, const T& value) {
+        clear();
+        insert(end(), count, value);
+    }
+
+    template <typename InputIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<InputIterator>::value>::type>
+    void assign(InputIterator first, InputIterator last) {
+        clear();
+        insert(end(), first, last);
+    }
+
+    void assign(std::initializer_list<T> init) {
+        assign(init.begin(), init.end());
+    }
+
+    allocator_type get_allocator() const { return alloc_; }
+
+    reference at(size_type pos) {
+        check_range(pos);
+        return data_[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        check_range(pos);
+        return data_[pos];
+    }
+
+    reference operator[](size_type pos) { return data_[pos]; }
+    const_reference operator[](size_type pos) const { return data_[pos]; }
+
+    reference front() { return data_[0]; }
+    const_reference front() const { return data_[0]; }
+    reference back() { return data_[size_ - 1]; }
+    const_reference back() const { return data_[size_ - 1]; }
+
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+
+    iterator begin() { return data_; }
+    const_iterator begin() const { return data_; }
+    const_iterator cbegin() const { return data_; }
+    iterator end() { return data_ + size_; }
+    const_iterator end() const { return data_ + size_; }
+    const_iterator cend() const { return data_ + size_; }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator crbegin() const { return rbegin(); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crend() const { return rend(); }
+
+    bool empty() const { return size_ == 0; }
+    size_type size() const { return size_; }
+    size_type max_size() const { return alloc_traits::max_size(alloc_); }
+    size_type capacity() const { return capacity_; }
+
+    /**
+     * @brief Test whether the elements are stored within this object,
+     * rather than on the heap
+     */
+    bool is_inline() const { return data_ == inline_data(); }
+
+    void reserve(size_type new_capacity) {
+        if (new_capacity > capacity_) {
+            reallocate(new_capacity);
+        }
+    }
+
+    // Returns to inline storage if the elements fit
+    void shrink_to_fit() {
+        if (!is_inline() && size_ < capacity_) {
+            reallocate(size_);
+        }
+    }
+
+    void clear() {
+        destroy(begin(), end());
+        size_ = 0;
+    }
+
+    iterator insert(const_iterator pos, const T& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, T&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    iterator insert(const_iterator pos, size_type count, const T& value) {
+        // 'value' may be an element, which reserving could move
+        const T copy(value);
+        size_type offset = pos - begin();
+        reserve(size_ + count);
+        for (size_type i = 0; i < count; ++i) {
+            emplace_back(copy);
+        }
+        std::rotate(begin() + offset, end() - count, end());
+        return begin() + offset;
+    }
+
+    // Elements are appended and then rotated in to place, which works for
+    // single pass iterators
+    template <typename InputIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<InputIterator>::value>::type>
+    iterator insert(const_iterator pos, InputIterator first,
+                    InputIterator last) {
+        size_type offset = pos - begin();
+        size_type old_size = size_;
+        reserve_for(first, last,
+                    typename std::iterator_traits<
+                        InputIterator>::iterator_category{});
+        for (; first != last; ++first) {
+            emplace_back(*first);
+        }
+        std::rotate(begin() + offset, begin() + old_size, end());
+        return begin() + offset;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<T> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        size_type offset = pos - begin();
+        emplace_back(std::forward<Args>(args)...);
+        std::rotate(begin() + offset, end() - 1, end());
+        return begin() + offset;
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        iterator out = begin() + (first - begin());
+        if (first != last) {
+            iterator new_end = std::move(out + (last - first), end(), out);
+            destroy(new_end, end());
+            size_ = new_end - begin();
+        }
+        return out;
+    }
+
+    void push_back(const T& value) { emplace_back(value); }
+    void push_back(T&& value) { emplace_back(std::move(value)); }
+
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        if (size_ == capacity_) {
+            // The new element is constructed before the existing elements
+            // are moved, in case args refer to one of them
+            size_type new_capacity = grown_capacity(size_ + 1);
+            T* new_data = alloc_traits::allocate(alloc_, new_capacity);
+            try {
+                alloc_traits::construct(alloc_, new_data + size_,
+                                        std::forward<Args>(args)...);
+            } catch (...) {
+                alloc_traits::deallocate(alloc_, new_data, new_capacity);
+                throw;
+            }
+            try {
+                move_elements_to(new_data);
+            } catch (...) {
+                alloc_traits::destroy(alloc_, new_data + size_);
+                alloc_traits::deallocate(alloc_, new_data, new_capacity);
+                throw;
+            }
+            adopt(new_data, new_capacity);
+        } else {
+            alloc_traits::construct(alloc_, data_ + size_,
+                                    std::forward<Args>(args)...);
+        }
+        return data_[size_++];
+    }
+
+    void pop_back() {
+        --size_;
+        alloc_traits::destroy(alloc_, data_ + size_);
+    }
+
+    void resize(size_type count) {
+        if (count < size_) {
+            erase(begin() + count, end());
+        } else {
+            reserve(count);
+            while (size_ < count) {
+                emplace_back();
+            }
+        }
+    }
+
+    void resize(size_type count, const T& value) {
+        if (count < size_) {
+            erase(begin() + count, end());
+        } else {
+            insert(end(), count - size_, value);
+        }
+    }
+
+    void swap(basic_small_vector& other) {
+        basic_small_vector temp(std::move(other));
+        other = std::move(*this);
+        *this = std::move(temp);
+    }
+
+    friend void swap(basic_small_vector& lhs, basic_small_vector& rhs) {
+        lhs.swap(rhs);
+    }
+
+    friend bool operator==(const basic_small_vector& lhs,
+                           const basic_small_vector& rhs) {
+        return lhs.size() == rhs.size() &&
+               std::equal(lhs.begin(), lhs.end(), rhs.begin());
+    }
+
+    friend bool operator!=(const basic_small_vector& lhs,
+                           const basic_small_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const basic_small_vector& lhs,
+                          const basic_small_vector& rhs) {
+        return std::lexicographical_compare(lhs.begin(), lhs.end(),
+                                            rhs.begin(), rhs.end());
+    }
+
+    friend bool operator>(const basic_small_vector& lhs,
+                          const basic_small_vector& rhs) {
+        return rhs < lhs;
+    }
+
+    friend bool operator<=(const basic_small_vector& lhs,
+                           const basic_small_vector& rhs) {
+        return !(rhs < lhs);
+    }
+
+    friend bool operator>=(const basic_small_vector& lhs,
+                           const basic_small_vector& rhs) {
+        return !(lhs < rhs);
+    }
+
+private:
+    T* inline_data() {
+        return reinterpret_cast<T*>(static_cast<void*>(inline_));
+    }
+
+    const T* inline_data() const {
+        return reinterpret_cast<const T*>(static_cast<const void*>(inline_));
+    }
+
+    void check_range(size_type pos) const {
+        if (pos >= size_) {
+            throw std::out_of_range("basic_small_vector::at");
+        }
+    }
+
+    size_type grown_capacity(size_type needed) const {
+        return std::max(needed, capacity_ * 2);
+    }
+
+    template <typename Iterator>
+    void reserve_for(Iterator first, Iterator last,
+                     std::forward_iterator_tag) {
+        reserve(size_ + std::distance(first, last));
+    }
+
+    template <typename Iterator>
+    void reserve_for(Iterator, Iterator, std::input_iterator_tag) {}
+
+    void destroy(iterator first, iterator last) {
+        for (; first != last; ++first) {
+            alloc_traits::destroy(alloc_, first);
+        }
+    }
+
+    // Free the heap buffer, if there is one
+    void release() {
+        if (!is_inline()) {
+            alloc_traits::deallocate(alloc_, data_, capacity_);
+        }
+        data_ = inline_data();
+        capacity_ = N;
+    }
+
+    // Move (or, if moving may throw, copy) the elements to 'target'. If
+    // that throws, the elements constructed in 'target' are destroyed and
+    // this vector is left unchanged.
+    void move_elements_to(T* target) {
+        size_type moved = 0;
+        try {
+            for (; moved < size_; ++moved) {
+                alloc_traits::construct(alloc_, target + moved,
+                                        std::move_if_noexcept(data_[moved]));
+            }
+        } catch (...) {
+            destroy(target, target + moved);
+            throw;
+        }
+    }
+
+    // Destroy the elements, whose replacements have been constructed in
+    // 'new_data', and use it as the storage (or inline storage if it is
+    // null)
+    void adopt(T* new_data, size_type new_capacity) {
+        destroy(begin(), end());
+        release();
+        if (new_data) {
+            data_ = new_data;
+            capacity_ = new_capacity;
+        }
+    }
+
+    // Move the elements to 'new_data', which has room for 'new_capacity'
+    // elements, or to inline storage if 'new_data' is null. 'new_data' is
+    // freed if moving the elements throws.
+    void relocate(T* new_data, size_type new_capacity) {
+        try {
+            move_elements_to(new_data ? new_data : inline_data());
+        } catch (...) {
+            if (new_data) {
+                alloc_traits::deallocate(alloc_, new_data, new_capacity);
+            }
+            throw;
+        }
+        adopt(new_data, new_capacity);
+    }
+
+    void reallocate(size_type new_capacity) {
+        if (new_capacity <= N) {
+            relocate(nullptr, N);
+        } else {
+            relocate(alloc_traits::allocate(alloc_, new_capacity),
+                     new_capacity);
+        }
+    }
+
+    // Take the elements of 'other', which is left empty. A heap buffer is
+    // taken over if both use the same allocator, otherwise the elements are
+    // moved individually.
+    void take_from(basic_small_vector& other) {
+        if (!other.is_inline() && alloc_ == other.alloc_) {
+            release();
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.size_ = 0;
+            other.capacity_ = N;
+            return;
+        }
+
+        reserve(other.size_);
+        for (auto& item : other) {
+            emplace_back(std::move(item));
+        }
+        other.clear();
+        other.release();
+    }
+
+    T* data_;
+    size_type size_;
+    size_type capacity_;
+    Allocator alloc_;
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type inline_[N];
+};
+
+template <typename T, std::size_t N, typename Allocator>
+constexpr std::size_t basic_small_vector<T, N, Allocator>::inline_capacity;
+
+/**
+ * @brief An extended vector storing up to \a N elements without allocating
+ *
+ * Operations producing new containers (map(), zip(), ...) produce small
+ * vectors with the same inline capacity.
+ */
+template <typename T, std::size_t N = 8, typename Allocator = std::allocator<T>>
+using small_vector =
+    cec::extended_sequence_container<basic_small_vector<T, N, Allocator>>;
+}
+
+#endif
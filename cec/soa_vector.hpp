@@ -0,0 +1,734 @@
+#ifndef CEC_SOA_VECTOR
+#define CEC_SOA_VECTOR
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cec/extended_sequence_container.hpp>
+#include <cec/vector.hpp>
+
+namespace cec {
+
+/**
+ * @brief A reference to one row of a basic_soa_vector
+ *
+ * Holds a reference to each field of the row. Assigning to a soa_reference
+ * (from another row, or from a std::tuple) assigns to the referenced fields,
+ * and swapping two soa_references swaps the rows, so standard algorithms
+ * like std::sort work on basic_soa_vector. A soa_reference converts to a
+ * std::tuple of copies of the fields.
+ */
+template <typename... Ts>
+class soa_reference {
+    template <typename...>
+    friend class soa_reference;
+
+public:
+    using value_type = std::tuple<typename std::remove_const<Ts>::type...>;
+
+    explicit soa_reference(Ts&... fields) : fields_(fields...) {}
+
+    soa_reference(const soa_reference&) = default;
+
+    // A reference to mutable fields converts to one to const fields
+    template <typename... Us>
+    soa_reference(const soa_reference<Us...>& other) : fields_(other.fields_) {}
+
+    soa_reference& operator=(const soa_reference& other) {
+        fields_ = other.fields_;
+        return *this;
+    }
+
+    soa_reference& operator=(soa_reference&& other) {
+        move_fields(other, detail::make_index_pack<sizeof...(Ts)>());
+        return *this;
+    }
+
+    soa_reference& operator=(const value_type& value) {
+        fields_ = value;
+        return *this;
+    }
+
+    soa_reference& operator=(value_type&& value) {
+        fields_ = std::move(value);
+        return *this;
+    }
+
+    /// A reference to the field \a I of the row
+    template <std::size_t I>
+    typename std::tuple_element<I, std::tuple<Ts&...>>::type get() const {
+        return std::get<I>(fields_);
+    }
+
+    /// A copy of the row
+    operator value_type() const { return value_type(fields_); }
+
+    friend void swap(soa_reference lhs, soa_reference rhs) {
+        lhs.swap_fields(rhs, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    friend bool operator==(const soa_reference& lhs, const soa_reference& rhs) {
+        return lhs.fields_ == rhs.fields_;
+    }
+
+    friend bool operator==(const soa_reference& lhs, const value_type& rhs) {
+        return lhs.fields_ == rhs;
+    }
+
+    friend bool operator==(const value_type& lhs, const soa_reference& rhs) {
+        return lhs == rhs.fields_;
+    }
+
+    friend bool operator!=(const soa_reference& lhs, const soa_reference& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(const soa_reference& lhs, const value_type& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator!=(const value_type& lhs, const soa_reference& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend bool operator<(const soa_reference& lhs, const soa_reference& rhs) {
+        return lhs.fields_ < rhs.fields_;
+    }
+
+    friend bool operator<(const soa_reference& lhs, const value_type& rhs) {
+        return lhs.fields_ < rhs;
+    }
+
+    friend bool operator<(const value_type& lhs, const soa_reference& rhs) {
+        return lhs < rhs.fields_;
+    }
+
+private:
+    template <std::size_t... Indexes>
+    void move_fields(soa_reference& other, detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(fields_) =
+                 std::move(std::get<Indexes>(other.fields_)),
+             0)...);
+    }
+
+    template <std::size_t... Indexes>
+    void swap_fields(soa_reference& other, detail::index_pack<Indexes...>) {
+        using std::swap;
+        detail::allow_naked_pack_expansion(
+            (swap(std::get<Indexes>(fields_), std::get<Indexes>(other.fields_)),
+             0)...);
+    }
+
+    std::tuple<Ts&...> fields_;
+};
+
+/**
+ * @brief A random access iterator over the rows of a basic_soa_vector
+ *
+ * Dereferencing yields a soa_reference by value, so (as for
+ * std::vector<bool>) \a reference is not a true reference type.
+ */
+template <typename Container, typename Reference>
+class soa_iterator {
+    template <typename, typename>
+    friend class soa_iterator;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = typename Reference::value_type;
+    using difference_type = std::ptrdiff_t;
+    using reference = Reference;
+    using pointer = void;
+
+    soa_iterator() : container_(nullptr), index_(0) {}
+
+    soa_iterator(Container* container, difference_type index)
+        : container_(container), index_(index) {}
+
+    // An iterator converts to a const_iterator
+    template <typename OtherContainer, typename OtherReference,
+              typename = typename std::enable_if<std::is_convertible<
+                  OtherContainer*, Container*>::value>::type>
+    soa_iterator(const soa_iterator<OtherContainer, OtherReference>& other)
+        : container_(other.container_), index_(other.index_) {}
+
+    /// The index of the row this iterator refers to
+    difference_type index() const { return index_; }
+
+    reference operator*() const { return (*container_)[index_]; }
+
+    reference operator[](difference_type n) const {
+        return (*container_)[index_ + n];
+    }
+
+    soa_iterator& operator++() {
+        ++index_;
+        return *this;
+    }
+
+    soa_iterator operator++(int) {
+        soa_iterator copy(*this);
+        ++index_;
+        return copy;
+    }
+
+    soa_iterator& operator--() {
+        --index_;
+        return *this;
+    }
+
+    soa_iterator operator--(int) {
+        soa_iterator copy(*this);
+        --index_;
+        return copy;
+    }
+
+    soa_iterator& operator+=(difference_type n) {
+        index_ += n;
+        return *this;
+    }
+
+    soa_iterator& operator-=(difference_type n) {
+        index_ -= n;
+        return *this;
+    }
+
+    friend soa_iterator operator+(soa_iterator iter, difference_type n) {
+        return iter += n;
+    }
+
+    friend soa_iterator operator+(difference_type n, soa_iterator iter) {
+        return iter += n;
+    }
+
+    friend soa_iterator operator-(soa_iterator iter, difference_type n) {
+        return iter -= n;
+    }
+
+    friend difference_type operator-(const soa_iterator& lhs,
+                                     const soa_iterator& rhs) {
+        return lhs.index_ - rhs.index_;
+    }
+
+    friend bool operator==(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ == rhs.index_;
+    }
+
+    friend bool operator!=(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ != rhs.index_;
+    }
+
+    friend bool operator<(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ < rhs.index_;
+    }
+
+    friend bool operator>(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ > rhs.index_;
+    }
+
+    friend bool operator<=(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ <= rhs.index_;
+    }
+
+    friend bool operator>=(const soa_iterator& lhs, const soa_iterator& rhs) {
+        return lhs.index_ >= rhs.index_;
+    }
+
+private:
+    Container* container_;
+    difference_type index_;
+};
+
+namespace detail {
+
+// Whether T is a whole row (rather than a single field) when passed to
+// basic_soa_vector::emplace
+template <typename T>
+struct is_soa_row : std::false_type {};
+
+template <typename... Ts>
+struct is_soa_row<std::tuple<Ts...>> : std::true_type {};
+
+template <typename T1, typename T2>
+struct is_soa_row<std::pair<T1, T2>> : std::true_type {};
+
+template <typename... Ts>
+struct is_soa_row<soa_reference<Ts...>> : std::true_type {};
+
+template <typename... Args>
+struct is_soa_row_argument : std::false_type {};
+
+template <typename Arg>
+struct is_soa_row_argument<Arg>
+    : is_soa_row<typename std::decay<Arg>::type> {};
+
+// Field I of a row
+template <std::size_t I, typename Row>
+auto soa_field(Row&& row) -> decltype(std::get<I>(std::forward<Row>(row))) {
+    return std::get<I>(std::forward<Row>(row));
+}
+
+template <std::size_t I, typename... Ts>
+auto soa_field(const soa_reference<Ts...>& row)
+    -> decltype(row.template get<I>()) {
+    return row.template get<I>();
+}
+
+// Rows of tuples are stored as a basic_soa_vector, anything else as a
+// std::vector
+template <typename T>
+struct rebind_soa {
+    using type = std::vector<T>;
+};
+
+template <typename... Ts>
+struct rebind_soa<std::tuple<Ts...>> {
+    using type = basic_soa_vector<Ts...>;
+};
+} // end detail
+
+/**
+ * @brief A sequence of rows stored as a structure of arrays
+ *
+ * Each field of the rows (the value_type is \a std::tuple<Ts...>) is stored
+ * in its own contiguous column, a cec::vector. An operation which reads a
+ * single field therefore only touches the memory of that field: see
+ * column(), map_column() and filter_column(). Iterating yields rows as
+ * soa_references, so a basic_soa_vector also works with the standard
+ * algorithms, and as cec::soa_vector, with all of the extended operations.
+ *
+ * Like extendable_basic_string, this type is not itself an extended
+ * container. Use cec::soa_vector, which is.
+ *
+ * Iterators and references are invalidated as for \a std::vector.
+ */
+template <typename... Ts>
+class basic_soa_vector {
+    static_assert(sizeof...(Ts) > 0, "basic_soa_vector requires a field");
+
+public:
+    using value_type = std::tuple<Ts...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = soa_reference<Ts...>;
+    using const_reference = soa_reference<const Ts...>;
+    using iterator = soa_iterator<basic_soa_vector, reference>;
+    using const_iterator = soa_iterator<const basic_soa_vector, const_reference>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    /// The columns, one extended vector per field
+    using columns_type = std::tuple<cec::vector<Ts>...>;
+
+    /// The column holding field \a I
+    template <std::size_t I>
+    using column_type = typename std::tuple_element<I, columns_type>::type;
+
+    /// Rows of tuples (e.g., the results of map()) are rebound to another
+    /// basic_soa_vector, and anything else to a std::vector
+    template <typename Rebind>
+    using other = typename detail::rebind_soa<Rebind>::type;
+
+    basic_soa_vector() = default;
+
+    explicit basic_soa_vector(size_type count) { resize(count); }
+
+    template <typename InputIterator,
+              typename = typename std::enable_if<!std::is_integral<
+                  InputIterator>::value>::type,
+              typename = typename std::iterator_traits<
+                  InputIterator>::iterator_category>
+    basic_soa_vector(InputIterator first, InputIterator last) {
+        insert(end(), first, last);
+    }
+
+    basic_soa_vector(std::initializer_list<value_type> init)
+        : basic_soa_vector(init.begin(), init.end()) {}
+
+    /**
+     * @brief Create a basic_soa_vector from its columns, without copying
+     * @param[in] columns - The values of each field. These must all have the
+     *                      same size.
+     */
+    explicit basic_soa_vector(cec::vector<Ts>... columns)
+        : columns_(std::move(columns)...) {
+        if (!columns_match(detail::make_index_pack<sizeof...(Ts)>())) {
+            throw std::invalid_argument(
+                "basic_soa_vector: columns differ in size");
+        }
+    }
+
+    reference at(size_type pos) {
+        check_range(pos);
+        return (*this)[pos];
+    }
+
+    const_reference at(size_type pos) const {
+        check_range(pos);
+        return (*this)[pos];
+    }
+
+    reference operator[](size_type pos) {
+        return row(pos, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    const_reference operator[](size_type pos) const {
+        return row(pos, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    reference front() { return (*this)[0]; }
+    const_reference front() const { return (*this)[0]; }
+    reference back() { return (*this)[size() - 1]; }
+    const_reference back() const { return (*this)[size() - 1]; }
+
+    /// The column holding field \a I of every row
+    template <std::size_t I>
+    column_type<I>& column() {
+        return std::get<I>(columns_);
+    }
+
+    template <std::size_t I>
+    const column_type<I>& column() const {
+        return std::get<I>(columns_);
+    }
+
+    /// All of the columns. Moving them out of a temporary does not copy.
+    const columns_type& columns() const & { return columns_; }
+
+    columns_type columns() && { return std::move(columns_); }
+
+    iterator begin() { return iterator(this, 0); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator cbegin() const { return begin(); }
+    iterator end() { return iterator(this, size()); }
+    const_iterator end() const { return const_iterator(this, size()); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const { return size() == 0; }
+    size_type size() const { return std::get<0>(columns_).size(); }
+
+    /// The number of rows which can be held without reallocating any column
+    size_type capacity() const {
+        return capacity_helper(detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    void reserve(size_type new_capacity) {
+        reserve_helper(new_capacity, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    void clear() { truncate(0); }
+
+    void pop_back() { truncate(size() - 1); }
+
+    void resize(size_type count) {
+        if (count < size()) {
+            truncate(count);
+        } else {
+            resize_helper(count, detail::make_index_pack<sizeof...(Ts)>());
+        }
+    }
+
+    /**
+     * @brief Append a row, given either the whole row (a std::tuple,
+     * std::pair or soa_reference) or an argument for each field
+     */
+    template <typename... Args>
+    reference emplace_back(Args&&... args) {
+        auto old_size = size();
+        try {
+            append(detail::is_soa_row_argument<Args...>{},
+                   detail::make_index_pack<sizeof...(Ts)>(),
+                   std::forward<Args>(args)...);
+        } catch (...) {
+            truncate(old_size);
+            throw;
+        }
+        return back();
+    }
+
+    template <typename... Args>
+    iterator emplace(const_iterator pos, Args&&... args) {
+        auto index = pos.index();
+        emplace_back(std::forward<Args>(args)...);
+        rotate_rows(index, size() - 1);
+        return begin() + index;
+    }
+
+    void push_back(const value_type& value) { emplace_back(value); }
+    void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+    iterator insert(const_iterator pos, const value_type& value) {
+        return emplace(pos, value);
+    }
+
+    iterator insert(const_iterator pos, value_type&& value) {
+        return emplace(pos, std::move(value));
+    }
+
+    template <typename InputIterator,
+              typename = typename std::enable_if<!std::is_integral<
+                  InputIterator>::value>::type>
+    iterator insert(const_iterator pos, InputIterator first,
+                    InputIterator last) {
+        auto index = pos.index();
+        auto old_size = size();
+        try {
+            for (; first != last; ++first) {
+                emplace_back(*first);
+            }
+        } catch (...) {
+            truncate(old_size);
+            throw;
+        }
+        rotate_rows(index, old_size);
+        return begin() + index;
+    }
+
+    iterator insert(const_iterator pos, std::initializer_list<value_type> init) {
+        return insert(pos, init.begin(), init.end());
+    }
+
+    iterator erase(const_iterator pos) { return erase(pos, pos + 1); }
+
+    iterator erase(const_iterator first, const_iterator last) {
+        erase_helper(first.index(), last.index(),
+                     detail::make_index_pack<sizeof...(Ts)>());
+        return begin() + first.index();
+    }
+
+    /**
+     * @brief Apply \a f to field \a I of each row, reading only that column
+     * @param[in] f - A function taking the type of field \a I
+     * @return An extended vector of the results
+     *
+     * Equivalent to column<I>().map(f).
+     */
+    template <std::size_t I, typename UnaryFunction>
+    auto map_column(UnaryFunction f) const
+        -> decltype(std::declval<const column_type<I>&>().map(f)) {
+        return column<I>().map(f);
+    }
+
+    /**
+     * @brief Create a new soa_vector of the rows for which \a p returns true
+     * for field \a I
+     *
+     * The predicate reads only column \a I. The other columns are only read
+     * to copy the selected rows.
+     *
+     * @param[in] p - A predicate taking the type of field \a I
+     * @return A soa_vector of the selected rows
+     *
+     * Example Usage:
+     * @code
+     *    cec::soa_vector<std::string, int> people = {
+     *        std::make_tuple("ann", 34), std::make_tuple("bob", 17)};
+     *
+     *    // contains { {"ann", 34} }
+     *    auto adults = people.filter_column<1>([](int age) {
+     *        return age >= 18;
+     *    });
+     * @endcode
+     */
+    template <std::size_t I, typename UnaryPredicate>
+    extended_sequence_container<basic_soa_vector>
+    filter_column(UnaryPredicate p) const {
+        const auto& keys = column<I>();
+        std::vector<size_type> selected;
+        for (size_type i = 0; i < keys.size(); ++i) {
+            if (p(keys[i])) {
+                selected.push_back(i);
+            }
+        }
+
+        extended_sequence_container<basic_soa_vector> filtered;
+        filtered.gather(*this, selected,
+                        detail::make_index_pack<sizeof...(Ts)>());
+        return filtered;
+    }
+
+    void swap(basic_soa_vector& other) { columns_.swap(other.columns_); }
+
+    friend void swap(basic_soa_vector& lhs, basic_soa_vector& rhs) {
+        lhs.swap(rhs);
+    }
+
+    friend bool operator==(const basic_soa_vector& lhs,
+                           const basic_soa_vector& rhs) {
+        return lhs.columns_ == rhs.columns_;
+    }
+
+    friend bool operator!=(const basic_soa_vector& lhs,
+                           const basic_soa_vector& rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    void check_range(size_type pos) const {
+        if (pos >= size()) {
+            throw std::out_of_range("basic_soa_vector::at");
+        }
+    }
+
+    template <std::size_t... Indexes>
+    reference row(size_type pos, detail::index_pack<Indexes...>) {
+        return reference(std::get<Indexes>(columns_)[pos]...);
+    }
+
+    template <std::size_t... Indexes>
+    const_reference row(size_type pos, detail::index_pack<Indexes...>) const {
+        return const_reference(std::get<Indexes>(columns_)[pos]...);
+    }
+
+    template <std::size_t... Indexes>
+    bool columns_match(detail::index_pack<Indexes...>) const {
+        std::size_t sizes[] = {std::get<Indexes>(columns_).size()...};
+        return std::all_of(std::begin(sizes), std::end(sizes),
+                           [&](std::size_t s) { return s == sizes[0]; });
+    }
+
+    template <std::size_t... Indexes>
+    size_type capacity_helper(detail::index_pack<Indexes...>) const {
+        return std::min({std::get<Indexes>(columns_).capacity()...});
+    }
+
+    template <std::size_t... Indexes>
+    void reserve_helper(size_type new_capacity,
+                        detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).reserve(new_capacity), 0)...);
+    }
+
+    template <std::size_t... Indexes>
+    void resize_helper(size_type count, detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).resize(count), 0)...);
+    }
+
+    // Append a whole row
+    template <std::size_t... Indexes, typename Row>
+    void append(std::true_type, detail::index_pack<Indexes...>, Row&& row) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).emplace_back(
+                 detail::soa_field<Indexes>(std::forward<Row>(row))),
+             0)...);
+    }
+
+    // Append a row given field by field
+    template <std::size_t... Indexes, typename... Args>
+    void append(std::false_type, detail::index_pack<Indexes...>,
+                Args&&... args) {
+        static_assert(sizeof...(Args) == sizeof...(Ts),
+                      "emplace requires a row, or a value for each field");
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).emplace_back(
+                 std::forward<Args>(args)),
+             0)...);
+    }
+
+    // Move the rows from 'middle' to the end in front of the rows from
+    // 'first', the way each insertion reaches its position after appending
+    void rotate_rows(size_type first, size_type middle) {
+        rotate_helper(first, middle, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    template <std::size_t... Indexes>
+    void rotate_helper(size_type first, size_type middle,
+                       detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::rotate(std::get<Indexes>(columns_).begin() + first,
+                         std::get<Indexes>(columns_).begin() + middle,
+                         std::get<Indexes>(columns_).end()),
+             0)...);
+    }
+
+    // Remove the rows beyond 'count', including from columns which were
+    // only partially appended to
+    void truncate(size_type count) {
+        truncate_helper(count, detail::make_index_pack<sizeof...(Ts)>());
+    }
+
+    template <std::size_t... Indexes>
+    void truncate_helper(size_type count, detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).erase(
+                 std::get<Indexes>(columns_).begin() +
+                     std::min(count, std::get<Indexes>(columns_).size()),
+                 std::get<Indexes>(columns_).end()),
+             0)...);
+    }
+
+    template <std::size_t... Indexes>
+    void erase_helper(size_type first, size_type last,
+                      detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (std::get<Indexes>(columns_).erase(
+                 std::get<Indexes>(columns_).begin() + first,
+                 std::get<Indexes>(columns_).begin() + last),
+             0)...);
+    }
+
+    // Copy the rows of 'source' at the indexes 'selected', column by column
+    template <std::size_t... Indexes>
+    void gather(const basic_soa_vector& source,
+                const std::vector<size_type>& selected,
+                detail::index_pack<Indexes...>) {
+        detail::allow_naked_pack_expansion(
+            (gather_column(std::get<Indexes>(columns_),
+                           std::get<Indexes>(source.columns_), selected),
+             0)...);
+    }
+
+    template <typename Column>
+    static void gather_column(Column& target, const Column& source,
+                              const std::vector<size_type>& selected) {
+        target.reserve(selected.size());
+        for (auto index : selected) {
+            target.push_back(source[index]);
+        }
+    }
+
+    columns_type columns_;
+};
+
+/**
+ * @brief An extended sequence of rows, with each field stored in its own
+ * contiguous column
+ *
+ * Operations producing rows of tuples (map(), zip_n(), ...) produce further
+ * soa_vectors, and any other results are cec::vectors.
+ *
+ * Example Usage:
+ * @code
+ *    cec::vector<std::pair<int, float>> pairs = {{1, 5.0}, {2, 17.2}};
+ *
+ *    // stores the ints and the floats in separate columns
+ *    cec::soa_vector<int, float> soa = pairs.unzip_soa();
+ *
+ *    // reads only the floats
+ *    float total = soa.column<1>().reduce(std::plus<float>(), 0.0f);
+ * @endcode
+ */
+template <typename... Ts>
+using soa_vector = cec::extended_sequence_container<basic_soa_vector<Ts...>>;
+}
+
+#endif
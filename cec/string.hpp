@@ -3,8 +3,19 @@
 
 #include <string>
 #include <regex>
+#include <stdexcept>
 #include <cec/extended_sequence_container.hpp>
 #include <cec/vector.hpp>
+#include <cec/detail/ascii.hpp>
+#include <cec/detail/config.hpp>
+
+#ifdef CEC_HAS_STRING_VIEW
+#include <string_view>
+#endif
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+#include <memory_resource>
+#endif
 
 namespace cec {
 
@@ -49,14 +60,77 @@ public:
     template <typename Container = cec::vector<
                   cec::extended_sequence_container<extendable_basic_string>>>
     Container split(std::regex delimiter = std::regex("\\S+")) const {
-        Container container;
+        auto container = detail::make_rebound<Container>(*this);
+        auto append = detail::make_appender(container);
         auto iter = std::sregex_iterator(this->begin(), this->end(), delimiter);
         for (; iter != std::sregex_iterator{}; ++iter) {
-            container.emplace(container.end(), iter->str());
+            append.emplace(iter->str());
         }
         return container;
     }
 
+#ifdef CEC_HAS_STRING_VIEW
+    /**
+     * @brief Split this string on each occurrence of the character
+     * \a delimiter, without copying.
+     *
+     * Unlike split(), the delimiter is a literal, and the returned
+     * string_views refer to the characters of this string, so must not
+     * outlive it. Adjacent delimiters produce empty fields, and a string
+     * without the delimiter produces a single field.
+     *
+     * @param[in] delimiter - The character to split on
+     *
+     * @return The fields in a container of type \a Container (by default
+     * cec::vector<std::basic_string_view<CharT>>)
+     *
+     * Example Usage:
+     * @code
+     *    cec::string line = "a,b,,c";
+     *    auto fields = line.split_view(',');
+     *    // fields == {"a", "b", "", "c"}
+     * @endcode
+     *
+     * @note Only available when compiling for C++17 or later
+     */
+    template <typename Container =
+                  cec::vector<std::basic_string_view<CharT, Traits>>>
+    Container split_view(CharT delimiter) const & {
+        return split_view_helper<Container>(delimiter, 1);
+    }
+
+    /**
+     * @brief Split this string on each occurrence of the substring
+     * \a delimiter, without copying.
+     *
+     * @param[in] delimiter - The (non-empty) string to split on
+     *
+     * @return The fields in a container of type \a Container (by default
+     * cec::vector<std::basic_string_view<CharT>>)
+     *
+     * \see split_view(CharT)
+     */
+    template <typename Container =
+                  cec::vector<std::basic_string_view<CharT, Traits>>>
+    Container
+    split_view(std::basic_string_view<CharT, Traits> delimiter) const & {
+        if (delimiter.empty()) {
+            throw std::invalid_argument("split_view: empty delimiter");
+        }
+        return split_view_helper<Container>(delimiter, delimiter.size());
+    }
+
+    // Views of a temporary would immediately dangle
+    template <typename Container =
+                  cec::vector<std::basic_string_view<CharT, Traits>>>
+    Container split_view(CharT delimiter) && = delete;
+
+    template <typename Container =
+                  cec::vector<std::basic_string_view<CharT, Traits>>>
+    Container
+    split_view(std::basic_string_view<CharT, Traits> delimiter) && = delete;
+#endif
+
     /**
      * @brief Join a collection of strings together using this string as
      * the delimter
@@ -75,17 +149,24 @@ public:
     template <typename Container>
     cec::extended_sequence_container<extendable_basic_string>
     join(const Container& strings) const {
-        cec::extended_sequence_container<extendable_basic_string> joined;
+        auto joined = detail::make_rebound<
+            cec::extended_sequence_container<extendable_basic_string>>(*this);
 
-        if (strings.empty()) {
+        auto iter = std::begin(strings);
+        auto end = std::end(strings);
+        if (iter == end) {
             return joined;
         }
 
-        auto iter = strings.begin();
-        for (; std::next(iter) != strings.end(); ++iter) {
-            joined += (*iter + *this);
-        }
+        using part_type =
+            typename std::iterator_traits<decltype(iter)>::value_type;
+        join_reserve(joined, iter, end, detail::has_size<part_type>{});
+
         joined += *iter;
+        for (++iter; iter != end; ++iter) {
+            joined += *this;
+            joined += *iter;
+        }
         return joined;
     }
 
@@ -93,41 +174,93 @@ public:
      * Create a copy of this string converted to lower case
      *
      * @note This method is only suitable for converting case of
-     * ASCII encoded strings.
+     * ASCII encoded strings. Characters outside of the ASCII range are
+     * left unchanged, and the current locale is not consulted.
      *
      * @returns The lowercase string
      *
      * \see To convert to upper case: to_upper()
      */
-    cec::extended_sequence_container<extendable_basic_string> to_lower() const {
+    cec::extended_sequence_container<extendable_basic_string>
+    to_lower() const & {
         // TODO depend on boost for encoding awareness?
-        auto lowered = *this;
-        for (auto& letter : lowered) {
-            letter = std::tolower(letter);
-        }
+        cec::extended_sequence_container<extendable_basic_string> lowered(
+            *this);
+        detail::ascii_to_lower(&lowered[0], lowered.size());
         return lowered;
     }
 
+    // If 'this' is a modifiable r-value, convert in-place
+    cec::extended_sequence_container<extendable_basic_string> to_lower() && {
+        detail::ascii_to_lower(&(*this)[0], this->size());
+        return std::move(*this);
+    }
+
     /**
      * Create a copy of this string converted to upper case
      *
      * @note This method is only suitable for converting case of
-     * ASCII encoded strings.
+     * ASCII encoded strings. Characters outside of the ASCII range are
+     * left unchanged, and the current locale is not consulted.
      *
      * @returns The uppercase string
      *
      * \see To conver to lower case: to_lower()
      */
-    cec::extended_sequence_container<extendable_basic_string> to_upper() const {
+    cec::extended_sequence_container<extendable_basic_string>
+    to_upper() const & {
         // TODO depend on boost for encoding awareness?
-        auto uppered = *this;
-        for (auto& letter : uppered) {
-            letter = std::toupper(letter);
-        }
+        cec::extended_sequence_container<extendable_basic_string> uppered(
+            *this);
+        detail::ascii_to_upper(&uppered[0], uppered.size());
         return uppered;
     }
 
+    // If 'this' is a modifiable r-value, convert in-place
+    cec::extended_sequence_container<extendable_basic_string> to_upper() && {
+        detail::ascii_to_upper(&(*this)[0], this->size());
+        return std::move(*this);
+    }
+
 protected:
+    // If the parts of a join know their size, the joined string can be
+    // allocated once up front. Otherwise it grows as parts are appended.
+    template <typename String, typename Iterator>
+    void join_reserve(String& joined, Iterator first, Iterator last,
+                      std::true_type) const {
+        std::size_t size = 0;
+        std::size_t parts = 0;
+        for (; first != last; ++first, ++parts) {
+            size += first->size();
+        }
+        joined.reserve(size + (parts - 1) * this->size());
+    }
+
+    template <typename String, typename Iterator>
+    void join_reserve(String&, Iterator, Iterator, std::false_type) const {}
+
+#ifdef CEC_HAS_STRING_VIEW
+    // string_view::find on a single character uses Traits::find, which is
+    // memchr for char
+    template <typename Container, typename Delimiter>
+    Container split_view_helper(Delimiter delimiter,
+                                std::size_t delimiter_size) const {
+        std::basic_string_view<CharT, Traits> remaining(this->data(),
+                                                        this->size());
+        auto container = detail::make_rebound<Container>(*this);
+        auto append = detail::make_appender(container);
+        for (;;) {
+            auto pos = remaining.find(delimiter);
+            if (pos == remaining.npos) {
+                append.emplace(remaining);
+                return container;
+            }
+            append.emplace(remaining.substr(0, pos));
+            remaining.remove_prefix(pos + delimiter_size);
+        }
+    }
+#endif
+
     template <typename Iter>
     auto emplace(Iter pos, CharT c) -> decltype(this->insert(pos, c)) {
         return this->insert(pos, c);
@@ -161,6 +294,37 @@ using u16string = cec::basic_string<char16_t>;
  * @brief A convenience alias for cec::basic_string<char32_t>
  */
 using u32string = cec::basic_string<char32_t>;
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+namespace pmr {
+
+/**
+ * @brief The extended basic_string type using a polymorphic allocator
+ */
+template <class CharT, class Traits = std::char_traits<CharT>>
+using basic_string =
+    cec::basic_string<CharT, Traits, std::pmr::polymorphic_allocator<CharT>>;
+
+/**
+ * @brief A convenience alias for cec::pmr::basic_string<char>
+ */
+using string = cec::pmr::basic_string<char>;
+
+/**
+ * @brief A convenience alias for cec::pmr::basic_string<wchar_t>
+ */
+using wstring = cec::pmr::basic_string<wchar_t>;
+}
+#endif
+}
+
+namespace std {
+
+// Extended strings hash as the strings they extend, so that they may be
+// used as keys (e.g., by distinct() and group_by())
+template <class CharT, class Allocator>
+struct hash<cec::basic_string<CharT, std::char_traits<CharT>, Allocator>>
+    : hash<std::basic_string<CharT, std::char_traits<CharT>, Allocator>> {};
 }
 
 #endif
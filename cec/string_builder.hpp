@@ -0,0 +1,212 @@
+#ifndef CEC_STRING_BUILDER
+#define CEC_STRING_BUILDER
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <cec/string.hpp>
+
+namespace cec {
+
+/**
+ * @brief Accumulates pieces of a string, and materializes them once
+ *
+ * Appending to a string whose final length is not known causes it to be
+ * reallocated (and its contents copied) each time it outgrows its capacity.
+ * A basic_string_builder instead stores appended characters in a list of
+ * blocks which are never moved, and copies them in to a single allocation
+ * of the exact final size when str() is called.
+ *
+ * Example Usage:
+ * @code
+ *    cec::string_builder builder;
+ *    for (const auto& record : records) {
+ *        // record.count is an int, formatted as by std::to_string
+ *        builder << record.name << ": " << record.count << '\n';
+ *    }
+ *    cec::string report = builder.str();
+ * @endcode
+ */
+template <class CharT, class Traits = std::char_traits<CharT>,
+          class Allocator = std::allocator<CharT>>
+class basic_string_builder {
+public:
+    /// The type produced by str()
+    using string_type = cec::basic_string<CharT, Traits, Allocator>;
+    using size_type = std::size_t;
+
+    basic_string_builder() : size_(0) {}
+
+    /**
+     * @brief Append \a count characters starting at \a s
+     */
+    basic_string_builder& append(const CharT* s, size_type count) {
+        while (count != 0) {
+            if (blocks_.empty() || blocks_.back().full()) {
+                add_block(count);
+            }
+            auto& block = blocks_.back();
+            size_type taken = std::min(count, block.capacity - block.size);
+            Traits::copy(block.data.get() + block.size, s, taken);
+            block.size += taken;
+            size_ += taken;
+            s += taken;
+            count -= taken;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Append the null terminated string \a s
+     */
+    basic_string_builder& append(const CharT* s) {
+        return append(s, Traits::length(s));
+    }
+
+    /**
+     * @brief Append the character \a c
+     */
+    basic_string_builder& append(CharT c) { return append(&c, 1); }
+
+    /**
+     * @brief Append the decimal representation of the number \a value, as
+     * produced by std::to_string
+     *
+     * Only \a CharT and \a char are appended as characters. Other
+     * arithmetic types (including signed and unsigned char) are formatted.
+     */
+    template <typename T>
+    typename std::enable_if<std::is_arithmetic<T>::value &&
+                                !std::is_same<T, CharT>::value &&
+                                !std::is_same<T, char>::value,
+                            basic_string_builder&>::type
+    append(T value) {
+        return append_narrow(std::to_string(value),
+                             std::is_same<CharT, char>{});
+    }
+
+    /**
+     * @brief Append the contents of \a s
+     */
+    template <typename OtherAllocator>
+    basic_string_builder&
+    append(const std::basic_string<CharT, Traits, OtherAllocator>& s) {
+        return append(s.data(), s.size());
+    }
+
+#ifdef CEC_HAS_STRING_VIEW
+    /**
+     * @brief Append the contents of \a s
+     */
+    basic_string_builder& append(std::basic_string_view<CharT, Traits> s) {
+        return append(s.data(), s.size());
+    }
+#endif
+
+    /**
+     * @brief Append \a value, equivalent to append(value)
+     */
+    template <typename T>
+    basic_string_builder& operator<<(const T& value) {
+        return append(value);
+    }
+
+    /**
+     * @brief The number of characters appended so far
+     */
+    size_type size() const { return size_; }
+
+    /**
+     * @brief Test whether nothing has been appended
+     */
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Discard everything appended so far
+     */
+    void clear() {
+        blocks_.clear();
+        size_ = 0;
+    }
+
+    /**
+     * @brief Create a string holding everything appended so far
+     *
+     * @return The built string, allocated once with its exact size
+     */
+    string_type str() const {
+        string_type built;
+        built.reserve(size_);
+        for (const auto& block : blocks_) {
+            built.append(block.data.get(), block.size);
+        }
+        return built;
+    }
+
+private:
+    basic_string_builder& append_narrow(const std::string& s, std::true_type) {
+        return append(s.data(), s.size());
+    }
+
+    // Formatted numbers are ASCII, so each character is simply widened
+    basic_string_builder& append_narrow(const std::string& s,
+                                        std::false_type) {
+        for (char c : s) {
+            append(static_cast<CharT>(c));
+        }
+        return *this;
+    }
+
+    // The smallest and largest capacities of newly added blocks. Blocks grow
+    // geometrically between the two, so building a short string does not
+    // over-allocate, and building a long one does not need many blocks.
+    static constexpr size_type min_block_size = 256;
+    static constexpr size_type max_block_size = 64 * 1024;
+
+    struct block {
+        std::unique_ptr<CharT[]> data;
+        size_type size;
+        size_type capacity;
+
+        bool full() const { return size == capacity; }
+    };
+
+    // A single append larger than the growth policy would allow is given a
+    // block of its own size, so it is copied in one piece
+    void add_block(size_type needed) {
+        size_type capacity =
+            blocks_.empty()
+                ? min_block_size
+                : std::min(blocks_.back().capacity * 2, max_block_size);
+        capacity = std::max(capacity, needed);
+        blocks_.push_back(
+            block{std::unique_ptr<CharT[]>(new CharT[capacity]), 0, capacity});
+    }
+
+    std::vector<block> blocks_;
+    size_type size_;
+};
+
+template <class CharT, class Traits, class Allocator>
+constexpr typename basic_string_builder<CharT, Traits, Allocator>::size_type
+    basic_string_builder<CharT, Traits, Allocator>::min_block_size;
+
+template <class CharT, class Traits, class Allocator>
+constexpr typename basic_string_builder<CharT, Traits, Allocator>::size_type
+    basic_string_builder<CharT, Traits, Allocator>::max_block_size;
+
+/**
+ * @brief A convenience alias for cec::basic_string_builder<char>
+ */
+using string_builder = cec::basic_string_builder<char>;
+
+/**
+ * @brief A convenience alias for cec::basic_string_builder<wchar_t>
+ */
+using wstring_builder = cec::basic_string_builder<wchar_t>;
+}
+
+#endif
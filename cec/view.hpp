@@ -0,0 +1,218 @@
+#ifndef CEC_VIEW
+#define CEC_VIEW
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <cec/detail/extended_sequence_container.hpp>
+#include <cec/detail/view.hpp>
+
+namespace cec {
+
+template <typename Iterator>
+class sequence_view;
+
+namespace detail {
+
+template <typename T>
+struct is_sequence_view : std::false_type {};
+
+template <typename Iterator>
+struct is_sequence_view<sequence_view<Iterator>> : std::true_type {};
+} // end detail
+
+/**
+ * @brief A lazy, non-owning view of a sequence
+ *
+ * Unlike the members of extended_sequence_container, the operations of
+ * sequence_view do not copy anything. Each operation returns a new view
+ * wrapping the previous one, and elements are only computed as the view is
+ * iterated (or materialized with to()). A chain of operations is therefore
+ * evaluated in a single pass, and stops as soon as the final stage is
+ * exhausted.
+ *
+ * As a view does not own the elements it refers to, it must not outlive
+ * the container it was created from.
+ *
+ * Example Usage:
+ * @code
+ *    cec::vector<int> numbers = {1, 2, 3, 4, 5, 6, 7, 8};
+ *
+ *    // Only the first four elements are visited
+ *    auto evens = numbers.view()
+ *                     .map([](int i) { return i * 10; })
+ *                     .filter([](int i) { return i % 20 == 0; })
+ *                     .take(2)
+ *                     .to<cec::vector<int>>();
+ *    // evens == {20, 40}
+ * @endcode
+ */
+template <typename Iterator>
+class sequence_view {
+public:
+    /// The type of the iterators of this view
+    using iterator = Iterator;
+    using value_type = typename std::iterator_traits<Iterator>::value_type;
+    using reference = typename std::iterator_traits<Iterator>::reference;
+    using difference_type =
+        typename std::iterator_traits<Iterator>::difference_type;
+
+    /**
+     * @brief Create a view of the range [\a first, \a last)
+     */
+    sequence_view(Iterator first, Iterator last) : first_(first), last_(last) {}
+
+    iterator begin() const { return first_; }
+    iterator end() const { return last_; }
+
+    /**
+     * @brief Test whether this view has no elements
+     */
+    bool empty() const { return first_ == last_; }
+
+    /**
+     * @brief Create a view which applies a function to each element of this
+     * view
+     *
+     * @param[in] f - The function to map across this view
+     * @return A view of the results of \a f
+     */
+    template <typename UnaryFunction>
+    sequence_view<detail::map_iterator<Iterator, UnaryFunction>>
+    map(UnaryFunction f) const {
+        using iter = detail::map_iterator<Iterator, UnaryFunction>;
+        return {iter(first_, f), iter(last_, f)};
+    }
+
+    /**
+     * @brief Create a view of the elements of this view which satisfy a
+     * predicate
+     *
+     * @param[in] p - The predicate. Elements where \a p(element) returns \a
+     *                false are skipped
+     * @return The filtered view
+     */
+    template <typename UnaryPredicate>
+    sequence_view<detail::filter_iterator<Iterator, UnaryPredicate>>
+    filter(UnaryPredicate p) const {
+        using iter = detail::filter_iterator<Iterator, UnaryPredicate>;
+        return {iter(first_, last_, p), iter(last_, last_, p)};
+    }
+
+    /**
+     * @brief Create a view of the initial elements of this view
+     *
+     * @param[in] num - The maximum number of elements to take
+     * @return A view of the taken elements
+     */
+    sequence_view<detail::take_iterator<Iterator>>
+    take(difference_type num) const {
+        using iter = detail::take_iterator<Iterator>;
+        return {iter(first_, last_, num), iter(last_, last_, 0)};
+    }
+
+    /**
+     * @brief Create a view of the initial elements of this view satisfying a
+     * predicate
+     *
+     * @param[in] p - The predicate being satisfied
+     * @return A view of the taken elements
+     */
+    template <typename UnaryPredicate>
+    sequence_view<detail::take_while_iterator<Iterator, UnaryPredicate>>
+    take_while(UnaryPredicate p) const {
+        using iter = detail::take_while_iterator<Iterator, UnaryPredicate>;
+        return {iter(first_, last_, p), iter(last_, last_, p)};
+    }
+
+    /**
+     * @brief Create a view of the element-wise pairing of this view and
+     * \a other
+     *
+     * The resulting view ends when either this view or \a other is
+     * exhausted.
+     *
+     * @param[in] other - A container or view to pair with
+     * @return A view of pairs
+     */
+    template <typename Container>
+    auto zip(const Container& other) const -> sequence_view<
+        detail::zip_iterator<Iterator, decltype(std::begin(other))>> {
+        using iter =
+            detail::zip_iterator<Iterator, decltype(std::begin(other))>;
+        return {iter(first_, last_, std::begin(other), std::end(other)),
+                iter(last_, last_, std::end(other), std::end(other))};
+    }
+
+    // A view zipped with a temporary container would immediately dangle.
+    // Views only hold iterators, so temporary views may be zipped.
+    template <typename Container,
+              typename = typename std::enable_if<
+                  !detail::is_sequence_view<Container>::value>::type>
+    void zip(const Container&&) const = delete;
+
+    /**
+     * @brief Materialize this view in to a container
+     *
+     * @return A \a Container holding the elements of this view
+     */
+    template <typename Container>
+    Container to() const {
+        Container container;
+        auto append = detail::make_appender(container);
+        for (auto iter = first_; iter != last_; ++iter) {
+            append.emplace(*iter);
+        }
+        return container;
+    }
+
+private:
+    Iterator first_;
+    Iterator last_;
+};
+
+namespace detail {
+
+template <typename... Iterators>
+sequence_view<zip_n_iterator<false, Iterators...>>
+make_zip_view(const std::tuple<Iterators...>& firsts,
+              const std::tuple<Iterators...>& lasts, std::false_type) {
+    using iter = zip_n_iterator<false, Iterators...>;
+    return {iter(firsts, lasts), iter(lasts, lasts)};
+}
+
+template <typename... Iterators, std::size_t... Indexes>
+sequence_view<zip_n_iterator<true, Iterators...>>
+make_zip_view_helper(const std::tuple<Iterators...>& firsts,
+                     const std::tuple<Iterators...>& lasts,
+                     index_pack<Indexes...>) {
+    std::ptrdiff_t sizes[] = {static_cast<std::ptrdiff_t>(std::distance(
+        std::get<Indexes>(firsts), std::get<Indexes>(lasts)))...};
+    auto size = *std::min_element(std::begin(sizes), std::end(sizes));
+
+    using iter = zip_n_iterator<true, Iterators...>;
+    return {iter(firsts), iter(std::tuple<Iterators...>(
+                              std::next(std::get<Indexes>(firsts), size)...))};
+}
+
+template <typename... Iterators>
+sequence_view<zip_n_iterator<true, Iterators...>>
+make_zip_view(const std::tuple<Iterators...>& firsts,
+              const std::tuple<Iterators...>& lasts, std::true_type) {
+    return make_zip_view_helper(firsts, lasts,
+                                make_index_pack<sizeof...(Iterators)>());
+}
+
+// A view zipping the ranges [firsts, lasts)
+template <typename... Iterators>
+sequence_view<zip_n_iterator_t<Iterators...>>
+make_zip_view(const std::tuple<Iterators...>& firsts,
+              const std::tuple<Iterators...>& lasts) {
+    return make_zip_view(firsts, lasts, all_random_access<Iterators...>{});
+}
+} // end detail
+} // end cec
+
+#endif
@@ -0,0 +1,176 @@
+#include <gtest/gtest.h>
+#include <cec/arena.hpp>
+#include <cec/list.hpp>
+#include <cec/string.hpp>
+#include <cec/vector.hpp>
+#include <algorithm>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+template <typename T>
+using arena_vector = cec::vector<T, cec::arena_allocator<T>>;
+
+TEST(arena, current) {
+    EXPECT_EQ(cec::scoped_arena::current(), nullptr);
+    {
+        cec::scoped_arena outer;
+        EXPECT_EQ(cec::scoped_arena::current(), &outer);
+        {
+            cec::scoped_arena inner;
+            EXPECT_EQ(cec::scoped_arena::current(), &inner);
+        }
+        EXPECT_EQ(cec::scoped_arena::current(), &outer);
+    }
+    EXPECT_EQ(cec::scoped_arena::current(), nullptr);
+}
+
+TEST(arena, allocate) {
+    cec::scoped_arena arena(64);
+
+    void* small = arena.allocate(3, 1);
+    void* aligned = arena.allocate(16, 16);
+    EXPECT_NE(small, aligned);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(aligned) % 16, 0u);
+
+    // Larger than a block
+    void* large = arena.allocate(1000, 8);
+    EXPECT_NE(large, nullptr);
+
+    EXPECT_EQ(arena.allocation_count(), 3u);
+    EXPECT_EQ(arena.bytes_allocated(), 1019u);
+    EXPECT_EQ(arena.bytes_in_use(), 1019u);
+    EXPECT_GE(arena.bytes_reserved(), 1019u);
+
+    arena.deallocate(large, 1000);
+    EXPECT_EQ(arena.bytes_in_use(), 19u);
+    EXPECT_EQ(arena.peak_bytes(), 1019u);
+}
+
+TEST(arena, concurrent_allocate) {
+    cec::scoped_arena arena(64);
+    constexpr std::size_t threads = 4;
+    constexpr std::size_t allocations = 1000;
+
+    // Each allocation is filled with the index of the thread making it, so
+    // that overlapping allocations are detected
+    std::vector<std::vector<unsigned char*>> allocated(threads);
+    std::vector<std::thread> workers;
+    for (std::size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&arena, &allocated, t] {
+            for (std::size_t i = 0; i < allocations; ++i) {
+                auto p = static_cast<unsigned char*>(arena.allocate(24, 8));
+                std::fill(p, p + 24, static_cast<unsigned char>(t));
+                allocated[t].push_back(p);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    for (std::size_t t = 0; t < threads; ++t) {
+        for (auto p : allocated[t]) {
+            EXPECT_EQ(reinterpret_cast<std::uintptr_t>(p) % 8, 0u);
+            EXPECT_EQ(std::count(p, p + 24, t), 24);
+        }
+    }
+    EXPECT_EQ(arena.allocation_count(), threads * allocations);
+    EXPECT_EQ(arena.bytes_in_use(), threads * allocations * 24);
+    EXPECT_EQ(arena.peak_bytes(), threads * allocations * 24);
+}
+
+TEST(arena, operations) {
+    const arena_vector<int> numbers = {1, 2, 3, 4, 5, 6};
+    EXPECT_EQ(numbers.get_allocator().arena(), nullptr);
+
+    {
+        cec::scoped_arena arena;
+        auto evens = numbers.map([](int i) { return i * 2; })
+                         .filter([](int i) { return i % 4 == 0; });
+        EXPECT_EQ(evens.get_allocator().arena(), &arena);
+        EXPECT_EQ(evens, (arena_vector<int>{4, 8, 12}));
+
+        auto pairs = numbers.zip(evens);
+        EXPECT_EQ(pairs.get_allocator().arena(), &arena);
+        EXPECT_GT(arena.allocation_count(), 0u);
+        EXPECT_GT(arena.peak_bytes(), 0u);
+    }
+
+    // Without an arena, results use the allocator of the source
+    auto doubled = numbers.map([](int i) { return i * 2; });
+    EXPECT_EQ(doubled.get_allocator().arena(), nullptr);
+}
+
+TEST(arena, partition) {
+    // The rest of a list partitioned in an arena is allocated from the
+    // arena, so the nodes of the heap allocated list are moved rather than
+    // spliced in to it
+    using arena_list = cec::list<int, cec::arena_allocator<int>>;
+    arena_list numbers = {1, 2, 3, 4, 5};
+    cec::scoped_arena arena;
+    auto partitioned =
+        std::move(numbers).partition([](int i) { return i % 2 == 0; });
+    EXPECT_EQ(partitioned.first, (arena_list{2, 4}));
+    EXPECT_EQ(partitioned.second, (arena_list{1, 3, 5}));
+    EXPECT_EQ(partitioned.second.get_allocator().arena(), &arena);
+}
+
+TEST(arena, copy_out) {
+    arena_vector<int> kept;
+    {
+        const arena_vector<int> numbers = {1, 2, 3};
+        cec::scoped_arena arena;
+        auto mapped = numbers.map([](int i) { return i + 1; });
+        EXPECT_EQ(mapped.get_allocator().arena(), &arena);
+
+        // Copies are made with the current arena, so to keep a result, copy
+        // it once the arena is no longer current
+        kept = arena_vector<int>(mapped.begin(), mapped.end(),
+                                 cec::arena_allocator<int>(nullptr));
+    }
+    EXPECT_EQ(kept, (arena_vector<int>{2, 3, 4}));
+    EXPECT_EQ(kept.get_allocator().arena(), nullptr);
+}
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+TEST(arena, polymorphic_allocator) {
+    const cec::pmr::vector<int> numbers = {1, 2, 3};
+    cec::scoped_arena arena;
+    auto mapped = numbers.map([](int i) { return i * 3; });
+    EXPECT_EQ(mapped.get_allocator().resource(), arena.resource());
+    EXPECT_EQ(mapped, (cec::pmr::vector<int>{3, 6, 9}));
+
+    cec::pmr::string text("some words here");
+    auto words = text.split_view(' ');
+    EXPECT_EQ(words.size(), 3u);
+
+    // The resource of the previous arena is restored with it
+    {
+        cec::scoped_arena inner;
+        auto doubled = numbers.map([](int i) { return i * 2; });
+        EXPECT_EQ(doubled.get_allocator().resource(), inner.resource());
+    }
+    auto doubled = numbers.map([](int i) { return i * 2; });
+    EXPECT_EQ(doubled.get_allocator().resource(), arena.resource());
+}
+
+TEST(arena, polymorphic_partition) {
+    std::pmr::monotonic_buffer_resource resource;
+    cec::pmr::list<int> numbers({1, 2, 3, 4, 5}, &resource);
+    cec::scoped_arena arena;
+    auto partitioned =
+        std::move(numbers).partition([](int i) { return i > 2; });
+    EXPECT_EQ(partitioned.first, (cec::pmr::list<int>{3, 4, 5}));
+    EXPECT_EQ(partitioned.second, (cec::pmr::list<int>{1, 2}));
+    EXPECT_EQ(partitioned.second.get_allocator().resource(),
+              arena.resource());
+}
+
+TEST(arena, polymorphic_allocator_without_arena) {
+    const cec::pmr::vector<int> numbers = {1, 2, 3};
+    auto mapped = numbers.map([](int i) { return i * 3; });
+    EXPECT_EQ(mapped.get_allocator().resource(),
+              numbers.get_allocator().resource());
+}
+#endif
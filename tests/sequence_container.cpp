@@ -6,6 +6,14 @@
 #include <cec/string.hpp>
 #include <cec/vector.hpp>
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <string>
 
 // To test the container rebinding behavior, we need to define a few
 // structs here
@@ -35,6 +43,45 @@ using extended_MyTemplateList =
 
 } // End rebind_setup
 
+namespace allocator_setup {
+
+// An allocator distinguished by an id, to check which allocator the results
+// of an operation are given
+template <typename T>
+struct tagged_allocator {
+    using value_type = T;
+
+    tagged_allocator() : id(0) {}
+    explicit tagged_allocator(int id) : id(id) {}
+
+    template <typename U>
+    tagged_allocator(const tagged_allocator<U>& other) : id(other.id) {}
+
+    T* allocate(std::size_t n) { return std::allocator<T>().allocate(n); }
+    void deallocate(T* p, std::size_t n) {
+        std::allocator<T>().deallocate(p, n);
+    }
+
+    int id;
+};
+
+template <typename T, typename U>
+bool operator==(const tagged_allocator<T>& lhs,
+                const tagged_allocator<U>& rhs) {
+    return lhs.id == rhs.id;
+}
+
+template <typename T, typename U>
+bool operator!=(const tagged_allocator<T>& lhs,
+                const tagged_allocator<U>& rhs) {
+    return !(lhs == rhs);
+}
+
+template <typename T>
+using vector = cec::vector<T, tagged_allocator<T>>;
+
+} // End allocator_setup
+
 TEST(SequenceContainer, Rebind) {
     rebind_setup::extended_MyList list{};
 
@@ -54,6 +101,54 @@ TEST(SequenceContainer, construction) {
     cec::vector<float> vec;
 }
 
+TEST(SequenceContainer, allocator) {
+    using allocator_setup::tagged_allocator;
+    const allocator_setup::vector<int> numbers({1, 2, 3, 4},
+                                               tagged_allocator<int>(7));
+
+    auto mapped = numbers.map([](int i) { return i * 0.5; });
+    EXPECT_EQ(mapped.get_allocator().id, 7);
+    EXPECT_EQ(numbers.map(cec::par, [](int i) { return i * 2; })
+                  .get_allocator()
+                  .id,
+              7);
+    EXPECT_EQ(numbers.filter([](int i) { return i > 2; }).get_allocator().id,
+              7);
+    EXPECT_EQ(numbers.concat(numbers).get_allocator().id, 7);
+    EXPECT_EQ(numbers.take(2).get_allocator().id, 7);
+    EXPECT_EQ(numbers.zip(numbers).get_allocator().id, 7);
+    EXPECT_EQ(numbers.zip_n(numbers, numbers).get_allocator().id, 7);
+
+    auto unzipped = numbers.zip(numbers).unzip();
+    EXPECT_EQ(unzipped.first.get_allocator().id, 7);
+    EXPECT_EQ(unzipped.second.get_allocator().id, 7);
+
+    const allocator_setup::vector<allocator_setup::vector<int>> nested(
+        {numbers, numbers}, tagged_allocator<int>(3));
+    EXPECT_EQ(nested.flatten().get_allocator().id, 3);
+
+    // Containers which cannot share the allocator are default constructed
+    cec::vector<int> plain = nested.flatten<cec::vector<int>>();
+    EXPECT_EQ(plain.size(), 8u);
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+    std::pmr::monotonic_buffer_resource arena;
+    cec::pmr::vector<int> pmr_numbers({1, 2, 3}, &arena);
+    EXPECT_EQ(pmr_numbers.map([](int i) { return i * 2; })
+                  .get_allocator()
+                  .resource(),
+              &arena);
+    EXPECT_EQ(pmr_numbers.filter([](int i) { return i != 2; })
+                  .get_allocator()
+                  .resource(),
+              &arena);
+
+    cec::pmr::string delimiter(", ", &arena);
+    cec::vector<cec::string> parts = {"a", "b"};
+    EXPECT_EQ(delimiter.join(parts).get_allocator().resource(), &arena);
+#endif
+}
+
 TEST(SequenceContainer, concat) {
     const cec::vector<short> numbers = {1, 2, 3};
     const cec::vector<short> other_numbers = {4, 5, 6};
@@ -67,12 +162,142 @@ TEST(SequenceContainer, contains) {
     EXPECT_FALSE(numbers.contains(4));
 }
 
+namespace search_setup {
+// Place 'needle' at each position of containers of every length up to 80,
+// so that both the vector blocks and the remainders are searched
+template <typename T>
+void check_search() {
+    for (int size = 0; size < 80; ++size) {
+        cec::vector<T> haystack(size, T(1));
+        EXPECT_FALSE(haystack.contains(T(2)));
+        EXPECT_EQ(haystack.count(T(1)), size);
+        for (int i = 0; i < size; ++i) {
+            haystack[i] = T(2);
+            EXPECT_TRUE(haystack.contains(T(2)));
+            EXPECT_EQ(haystack.count(T(2)), i + 1);
+            EXPECT_EQ(haystack.count_if([](T t) { return t > T(1); }), i + 1);
+        }
+    }
+}
+} // end search_setup
+
+TEST(SequenceContainer, contains_vectorized) {
+    search_setup::check_search<char>();
+    search_setup::check_search<unsigned short>();
+    search_setup::check_search<int>();
+    search_setup::check_search<long long>();
+    search_setup::check_search<float>();
+    search_setup::check_search<double>();
+
+    // Values are compared as they would be by operator==
+    const cec::vector<unsigned char> bytes = {0, 255};
+    EXPECT_TRUE(bytes.contains(255));
+    EXPECT_FALSE(bytes.contains(-1));
+    EXPECT_FALSE(bytes.contains(256));
+
+    const cec::vector<int> numbers = {-1, 3};
+    EXPECT_FALSE(numbers.contains(3.5));
+    EXPECT_TRUE(numbers.contains(3.0));
+    EXPECT_TRUE(numbers.contains(-1L));
+
+    const double nan = std::numeric_limits<double>::quiet_NaN();
+    const cec::vector<double> reals = {-0.0, 0.5, nan};
+    EXPECT_TRUE(reals.contains(0.0));
+    EXPECT_EQ(reals.count(0.0), 1);
+    EXPECT_FALSE(reals.contains(nan));
+    EXPECT_EQ(reals.count(nan), 0);
+}
+
+TEST(SequenceContainer, distinct) {
+    const cec::vector<int> numbers = {3, 1, 3, 2, 1, 3};
+    EXPECT_EQ(numbers.distinct(), (cec::vector<int>{3, 1, 2}));
+    EXPECT_EQ(cec::vector<int>(numbers).distinct(),
+              (cec::vector<int>{3, 1, 2}));
+    EXPECT_TRUE(cec::list<int>().distinct().empty());
+
+    cec::list<std::string> words = {"b", "a", "b", "c", "a"};
+    EXPECT_EQ(words.distinct(), (cec::list<std::string>{"b", "a", "c"}));
+    const std::string* c = &*std::next(words.begin(), 3);
+    auto unique_words = std::move(words).distinct();
+    EXPECT_EQ(unique_words, (cec::list<std::string>{"b", "a", "c"}));
+    EXPECT_EQ(&unique_words.back(), c);
+
+    // Enough elements to grow the set several times, with keys that would
+    // collide without mixing the hash
+    cec::vector<std::uint64_t> strided;
+    for (std::uint64_t i = 0; i < 5000; ++i) {
+        strided.push_back((i % 1000) << 20);
+    }
+    auto unique = std::move(strided).distinct();
+    ASSERT_EQ(unique.size(), 1000u);
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        EXPECT_EQ(unique[i], i << 20);
+    }
+}
+
+TEST(SequenceContainer, distinct_by) {
+    auto initial = [](const std::string& s) { return s[0]; };
+    const cec::deque<std::string> words = {"apple", "avocado", "banana",
+                                           "blueberry", "cherry"};
+    const cec::deque<std::string> firsts = {"apple", "banana", "cherry"};
+    EXPECT_EQ(words.distinct_by(initial), firsts);
+    EXPECT_EQ(cec::deque<std::string>(words).distinct_by(initial), firsts);
+
+    // The key is evaluated once per element
+    int calls = 0;
+    words.distinct_by([&calls](const std::string& s) {
+        ++calls;
+        return s.size();
+    });
+    EXPECT_EQ(calls, 5);
+
+    cec::vector<std::unique_ptr<int>> pointers;
+    pointers.emplace_back(new int(1));
+    pointers.emplace_back(new int(1));
+    pointers.emplace_back(new int(2));
+    auto moved = std::move(pointers).distinct_by(
+        [](const std::unique_ptr<int>& p) { return *p; });
+    ASSERT_EQ(moved.size(), 2u);
+    EXPECT_EQ(*moved[1], 2);
+}
+
+TEST(SequenceContainer, erase_all) {
+    cec::vector<int> numbers = {1, 2, 1, 3};
+    EXPECT_EQ(numbers.erase_all(1), (cec::vector<int>{2, 3}));
+    EXPECT_EQ(numbers, (cec::vector<int>{2, 3}));
+
+    // Lists unlink the removed nodes, so the kept elements do not move
+    cec::list<std::string> words = {"a", "b", "a", "c"};
+    const std::string* c = &words.back();
+    words.erase_all("a");
+    EXPECT_EQ(words, (cec::list<std::string>{"b", "c"}));
+    EXPECT_EQ(&words.back(), c);
+
+    cec::forward_list<int> singly = {1, 2, 1, 3};
+    singly.erase_all(1).erase_if([](int i) { return i == 3; });
+    EXPECT_EQ(singly, (cec::forward_list<int>{2}));
+}
+
 TEST(SequenceContainer, extend) {
     cec::vector<char> letters = {'a', 'b', 'c'};
     const cec::vector<char> other_letters = {'d', 'e', 'f'};
     const cec::vector<char> all_letters = {'a', 'b', 'c', 'd', 'e', 'f'};
     letters.extend(other_letters);
     EXPECT_EQ(letters, all_letters);
+
+    // Lists of the same type are spliced
+    cec::list<std::string> words = {"a"};
+    cec::list<std::string> more = {"b", "c"};
+    const std::string* b = &more.front();
+    words.extend(std::move(more));
+    EXPECT_EQ(words, (cec::list<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(&*std::next(words.begin()), b);
+
+    cec::deque<std::unique_ptr<int>> pointers;
+    cec::deque<std::unique_ptr<int>> more_pointers;
+    more_pointers.emplace_back(new int(1));
+    pointers.extend(std::move(more_pointers));
+    EXPECT_EQ(*pointers.front(), 1);
 }
 
 TEST(SequenceContainer, filter) {
@@ -86,6 +311,46 @@ TEST(SequenceContainer, filter) {
     EXPECT_EQ(out, filtered);
 }
 
+namespace filter_setup {
+
+// Filtering and erasing from a contiguous container of arithmetic elements
+// matches std::copy_if, at sizes around the block sizes of the kernels
+template <typename T>
+void check_filter() {
+    for (std::size_t size : {0, 1, 3, 4, 7, 8, 15, 16, 17, 100, 257, 1000}) {
+        cec::vector<T> numbers;
+        for (std::size_t i = 0; i < size; ++i) {
+            numbers.push_back(static_cast<T>((i * 7919) % 101));
+        }
+        auto odd = [](T t) { return static_cast<long>(t) % 2 == 1; };
+
+        cec::vector<T> expected;
+        std::copy_if(numbers.begin(), numbers.end(),
+                     std::back_inserter(expected), odd);
+        EXPECT_EQ(numbers.filter(odd), expected);
+
+        auto copy = numbers;
+        EXPECT_EQ(std::move(copy).filter(odd), expected);
+
+        copy = numbers;
+        copy.erase_if([&odd](T t) { return !odd(t); });
+        EXPECT_EQ(copy, expected);
+    }
+}
+}
+
+TEST(SequenceContainer, filter_compact) {
+    filter_setup::check_filter<char>();
+    filter_setup::check_filter<short>();
+    filter_setup::check_filter<int>();
+    filter_setup::check_filter<float>();
+    filter_setup::check_filter<double>();
+    filter_setup::check_filter<std::uint64_t>();
+
+    cec::string text = "a1b2c3d4e5f6g7h8i9j0";
+    EXPECT_EQ(text.filter([](char c) { return c >= 'a'; }), "abcdefghij");
+}
+
 TEST(SequenceContainer, flatten) {
     cec::list<cec::vector<int>> nested = {{1, 2, 3}, {4, 5, 6}};
     cec::vector<int> flattened = nested.flatten();
@@ -98,6 +363,52 @@ TEST(SequenceContainer, flatten) {
     EXPECT_EQ(v_flattened, v_compare);
 }
 
+TEST(SequenceContainer, flatten_splice) {
+    // Temporary lists of lists are spliced together, so the nodes (and so
+    // the addresses of the elements) are kept
+    cec::list<cec::list<std::string>> nested = {{"a", "b"}, {}, {"c"}};
+    const std::string* c = &nested.back().front();
+    cec::list<std::string> flattened = std::move(nested).flatten();
+    EXPECT_EQ(flattened, (cec::list<std::string>{"a", "b", "c"}));
+    EXPECT_EQ(&flattened.back(), c);
+}
+
+TEST(SequenceContainer, flatten_all) {
+    const cec::vector<cec::vector<cec::vector<int>>> nested = {
+        {{1, 2}, {3}}, {}, {{}, {4, 5}}};
+    cec::vector<int> flattened = nested.flatten_all();
+    EXPECT_EQ(flattened, (cec::vector<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(flattened.capacity(), 5u);
+
+    std::list<int> as_list = nested.flatten_all<std::list<int>>();
+    EXPECT_EQ(as_list, (std::list<int>{1, 2, 3, 4, 5}));
+
+    // A single level is the same as flatten()
+    const cec::list<cec::deque<int>> shallow = {{1}, {2, 3}};
+    EXPECT_EQ(shallow.flatten_all(), shallow.flatten());
+
+    // Strings are kept whole, and moved out of temporaries
+    cec::deque<cec::list<cec::vector<std::string>>> words = {
+        {{"some", "words"}}, {{"and"}, {"more"}}};
+    cec::vector<std::string> all = std::move(words).flatten_all();
+    EXPECT_EQ(all, (cec::vector<std::string>{"some", "words", "and", "more"}));
+    EXPECT_TRUE(words.front().front().front().empty());
+
+    cec::vector<cec::vector<std::unique_ptr<int>>> pointers(2);
+    pointers[1].emplace_back(new int(1));
+    auto moved = std::move(pointers).flatten_all();
+    EXPECT_EQ(*moved.front(), 1);
+
+    // Containers of elements which are not containers are copied or moved
+    const cec::vector<std::string> strings = {"not", "nested"};
+    EXPECT_EQ(strings.flatten_all(), strings);
+    cec::vector<cec::string> text = {"some", "text"};
+    cec::vector<cec::string> moved_text = std::move(text).flatten_all();
+    EXPECT_EQ(moved_text, (cec::vector<cec::string>{"some", "text"}));
+    const cec::list<int> numbers = {1, 2, 3};
+    EXPECT_EQ(numbers.flatten_all(), numbers);
+}
+
 TEST(SequenceContainer, map) {
     const cec::deque<std::string> container = {"Some", "test", "strings"};
 
@@ -108,6 +419,249 @@ TEST(SequenceContainer, map) {
     EXPECT_EQ(mapped, compare);
 }
 
+TEST(SequenceContainer, flat_map) {
+    const cec::list<int> numbers = {1, 2, 3};
+    cec::list<int> repeated =
+        numbers.flat_map([](int i) { return std::vector<int>(i, i); });
+    EXPECT_EQ(repeated, (cec::list<int>{1, 2, 2, 3, 3, 3}));
+    auto as_list = [](int i) { return cec::list<int>(i, i); };
+    EXPECT_EQ(numbers.flat_map([](int i) { return cec::vector<int>(i, i); }),
+              numbers.map(as_list).flatten());
+
+    // Results returned by value are moved from
+    const cec::vector<std::string> names = {"a", "b"};
+    auto pointers = names.flat_map([](const std::string& name) {
+        std::vector<std::unique_ptr<std::string>> result;
+        result.emplace_back(new std::string(name));
+        return result;
+    });
+    EXPECT_EQ(*pointers.back(), "b");
+
+    // Elements are emitted to a sink instead
+    using words_type = cec::vector<std::string>;
+    const cec::vector<std::string> lines = {"some words", "", "more"};
+    auto split = [](const std::string& line, cec::sink<words_type>& out) {
+        std::size_t first = 0, last;
+        while ((last = line.find(' ', first)) != std::string::npos) {
+            out(line.substr(first, last - first));
+            first = last + 1;
+        }
+        if (first != line.size()) {
+            out.emplace(line, first, std::string::npos);
+        }
+    };
+    words_type words = lines.flat_map<std::string>(split);
+    EXPECT_EQ(words, (words_type{"some", "words", "more"}));
+
+    cec::vector<std::string> owned = lines;
+    words_type moved = std::move(owned).flat_map<std::string>(
+        [](std::string&& line, cec::sink<words_type>& out) {
+            out(std::move(line));
+        });
+    EXPECT_EQ(moved, lines);
+}
+
+// Every producing operation appends to forward_lists in order, after their
+// last element
+TEST(SequenceContainer, forward_list) {
+    using flist = cec::forward_list<int>;
+    const flist numbers = {1, 2, 3, 4};
+    auto is_even = [](int i) { return i % 2 == 0; };
+
+    EXPECT_EQ(numbers.map([](int i) { return i * 2; }), (flist{2, 4, 6, 8}));
+    EXPECT_EQ(numbers.filter(is_even), (flist{2, 4}));
+    EXPECT_EQ(numbers.concat(flist{5}), (flist{1, 2, 3, 4, 5}));
+    EXPECT_EQ(flist{1}.concat(numbers), (flist{1, 1, 2, 3, 4}));
+    EXPECT_EQ(flist(numbers).extend(flist{5, 6}), (flist{1, 2, 3, 4, 5, 6}));
+    EXPECT_EQ(numbers.distinct(), numbers);
+    EXPECT_EQ((flist{1, 2, 1}.distinct()), (flist{1, 2}));
+    EXPECT_EQ(flist(numbers).take(2), (flist{1, 2}));
+    EXPECT_EQ(flist(numbers).take_while([](int i) { return i < 3; }),
+              (flist{1, 2}));
+
+    auto zipped = numbers.zip(numbers.map([](int i) { return i * 0.5; }));
+    EXPECT_EQ(zipped.front(), (std::pair<int, double>(1, 0.5)));
+    auto unzipped = zipped.unzip();
+    EXPECT_EQ(unzipped.first, numbers);
+    EXPECT_EQ(unzipped.second.front(), 0.5);
+    EXPECT_EQ(numbers.zip_n(numbers, numbers).front(),
+              std::make_tuple(1, 1, 1));
+
+    auto partitioned = flist(numbers).partition(is_even);
+    EXPECT_EQ(partitioned.first, (flist{2, 4}));
+    EXPECT_EQ(partitioned.second, (flist{1, 3}));
+    EXPECT_EQ(numbers.partition(is_even).second, (flist{1, 3}));
+
+    auto by_parity = numbers.group_by(is_even);
+    EXPECT_EQ(by_parity[true], (flist{2, 4}));
+    EXPECT_EQ(by_parity[false], (flist{1, 3}));
+
+    const cec::forward_list<flist> nested = {{1, 2}, {3}};
+    EXPECT_EQ(nested.flatten(), (flist{1, 2, 3}));
+    EXPECT_EQ(nested.flatten_all(), (flist{1, 2, 3}));
+    EXPECT_EQ(cec::forward_list<flist>(nested).flatten(), (flist{1, 2, 3}));
+    EXPECT_EQ(numbers.flat_map([](int i) { return flist{i, i}; }),
+              (flist{1, 1, 2, 2, 3, 3, 4, 4}));
+    auto negate = [](int i, cec::sink<flist>& out) {
+        out(i);
+        out(-i);
+    };
+    EXPECT_EQ(numbers.flat_map<int>(negate),
+              (flist{1, -1, 2, -2, 3, -3, 4, -4}));
+
+    EXPECT_EQ(numbers.view().to<flist>(), numbers);
+}
+
+TEST(SequenceContainer, group_by) {
+    const cec::vector<std::string> words = {"a", "bb", "c", "dd", "eee"};
+    auto by_size =
+        words.group_by([](const std::string& s) { return s.size(); });
+    EXPECT_EQ(by_size.size(), 3u);
+    EXPECT_EQ(by_size[1], (cec::vector<std::string>{"a", "c"}));
+    EXPECT_EQ(by_size[2], (cec::vector<std::string>{"bb", "dd"}));
+    EXPECT_EQ(by_size[3].capacity(), 1u);
+
+    const cec::list<int> numbers = {1, 2, 3, 4, 5};
+    auto by_parity = numbers.group_by([](int i) { return i % 2 == 0; });
+    EXPECT_EQ(by_parity[false], (cec::list<int>{1, 3, 5}));
+    EXPECT_EQ(by_parity[true], (cec::list<int>{2, 4}));
+
+    // Elements of temporaries are moved in to their groups
+    cec::deque<std::unique_ptr<int>> pointers;
+    pointers.emplace_back(new int(1));
+    pointers.emplace_back(new int(2));
+    auto moved = std::move(pointers).group_by(
+        [](const std::unique_ptr<int>& p) { return *p; });
+    EXPECT_EQ(*moved[2].front(), 2);
+
+    EXPECT_TRUE(cec::vector<int>().group_by([](int i) { return i; }).empty());
+}
+
+TEST(SequenceContainer, merge) {
+    cec::vector<int> numbers = {1, 4, 6};
+    cec::vector<int> others = {2, 4, 5, 7};
+    numbers.merge(others);
+    EXPECT_EQ(numbers, (cec::vector<int>{1, 2, 4, 4, 5, 6, 7}));
+    EXPECT_TRUE(others.empty());
+
+    numbers.merge(numbers);
+    EXPECT_EQ(numbers.size(), 7u);
+
+    // Lists relink the nodes of the other list
+    cec::list<int> descending = {5, 3, 1};
+    cec::list<int> more = {4, 2};
+    const int* two = &more.back();
+    descending.merge(std::move(more), std::greater<int>());
+    EXPECT_EQ(descending, (cec::list<int>{5, 4, 3, 2, 1}));
+    EXPECT_EQ(&*std::next(descending.begin(), 3), two);
+
+    cec::forward_list<int> singly = {1, 3};
+    singly.merge(cec::forward_list<int>{2});
+    EXPECT_EQ(singly, (cec::forward_list<int>{1, 2, 3}));
+
+#ifdef CEC_HAS_MEMORY_RESOURCE
+    // Lists with unequal allocators cannot exchange nodes, so the elements
+    // are moved instead
+    std::pmr::monotonic_buffer_resource first_arena;
+    std::pmr::monotonic_buffer_resource second_arena;
+    cec::pmr::list<int> first({1, 3}, &first_arena);
+    cec::pmr::list<int> second({2, 4}, &second_arena);
+    first.merge(second);
+    EXPECT_EQ(first, (cec::pmr::list<int>{1, 2, 3, 4}));
+    EXPECT_TRUE(second.empty());
+
+    first.extend(cec::pmr::list<int>({5}, &second_arena));
+    EXPECT_EQ(first, (cec::pmr::list<int>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(first.get_allocator().resource(), &first_arena);
+#endif
+}
+
+TEST(SequenceContainer, partition) {
+    auto is_even = [](int i) { return i % 2 == 0; };
+    const cec::deque<int> numbers = {1, 2, 3, 4, 5};
+    auto partitioned = numbers.partition(is_even);
+    EXPECT_EQ(partitioned.first, (cec::deque<int>{2, 4}));
+    EXPECT_EQ(partitioned.second, (cec::deque<int>{1, 3, 5}));
+
+    auto moved = cec::vector<int>{1, 2, 3, 4, 5}.partition(is_even);
+    EXPECT_EQ(moved.first, (cec::vector<int>{2, 4}));
+    EXPECT_EQ(moved.second, (cec::vector<int>{1, 3, 5}));
+
+    // Lists are partitioned by splicing nodes
+    cec::list<std::string> words = {"keep", "drop", "keep"};
+    const std::string* dropped = &*std::next(words.begin());
+    auto spliced = std::move(words).partition(
+        [](const std::string& s) { return s == "keep"; });
+    EXPECT_EQ(spliced.first, (cec::list<std::string>{"keep", "keep"}));
+    EXPECT_EQ(&spliced.second.front(), dropped);
+
+    // The predicate is evaluated once per element
+    int calls = 0;
+    numbers.partition([&calls](int) { return ++calls % 2; });
+    EXPECT_EQ(calls, 5);
+}
+
+TEST(SequenceContainer, parallel) {
+    cec::vector<int> numbers(100000);
+    std::iota(numbers.begin(), numbers.end(), 0);
+    auto is_even = [](int i) { return i % 2 == 0; };
+
+    EXPECT_EQ(numbers.map(cec::par, [](int i) { return i * 2; }),
+              numbers.map([](int i) { return i * 2; }));
+    EXPECT_EQ(numbers.map(cec::par, [](int i) { return std::to_string(i); }),
+              numbers.map([](int i) { return std::to_string(i); }));
+    EXPECT_EQ(numbers.filter(cec::par_unseq, is_even), numbers.filter(is_even));
+    EXPECT_EQ(numbers.count_if(cec::par, is_even), 50000);
+    EXPECT_EQ(numbers.count(cec::par, 99999), 1);
+    EXPECT_TRUE(numbers.contains(cec::par, 99999));
+    EXPECT_FALSE(numbers.contains(cec::par, -1));
+
+    auto doubled = numbers;
+    doubled.transform(cec::par, [](int i) { return i * 2; });
+    EXPECT_EQ(doubled, numbers.map([](int i) { return i * 2; }));
+
+    auto erased = numbers;
+    erased.erase_if(cec::par, is_even);
+    EXPECT_EQ(erased, numbers.filter([](int i) { return i % 2 != 0; }));
+
+    // Non random access containers fall back to the serial algorithms
+    cec::list<int> list(numbers.begin(), numbers.end());
+    EXPECT_EQ(list.count_if(cec::par, is_even), 50000);
+    EXPECT_EQ(list.filter(cec::par, is_even).size(), 50000u);
+
+    // Exceptions are propagated to the caller
+    EXPECT_THROW(numbers.map(cec::par,
+                             [](int i) {
+                                 if (i == 70000) {
+                                     throw std::runtime_error("error");
+                                 }
+                                 return i;
+                             }),
+                 std::runtime_error);
+}
+
+TEST(SequenceContainer, parallel_reduce) {
+    cec::vector<double> values(100000);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        values[i] = 1.0 / (i + 1);
+    }
+    auto plus = [](double a, double b) { return a + b; };
+
+    // The result should not depend on the execution policy
+    double serial = values.reduce(cec::seq, plus);
+    EXPECT_EQ(values.reduce(cec::par, plus), serial);
+    EXPECT_EQ(values.reduce(cec::par_unseq, plus), serial);
+
+    const cec::list<std::string> words(10000, "word");
+    std::size_t total = words.reduce(
+        cec::par,
+        [](std::size_t sum, const std::string& s) { return sum + s.size(); },
+        std::size_t{0}, [](std::size_t a, std::size_t b) { return a + b; });
+    EXPECT_EQ(total, 40000u);
+
+    EXPECT_EQ(cec::vector<int>{}.reduce(cec::par, plus, 0.0, plus), 0.0);
+}
+
 TEST(SequenceContainer, reduce) {
     const cec::vector<std::string> msg_parts = {"Hel", "lo", ", wo", "rld"};
 
@@ -127,6 +681,82 @@ TEST(SequenceContainer, reduce) {
     EXPECT_EQ(msg_length, msg.size());
 }
 
+TEST(SequenceContainer, fold_left) {
+    const cec::vector<std::string> msg_parts = {"Hel", "lo", ", wo", "rld"};
+
+    // The accumulator is never copied, so the buffer reserved for it up
+    // front is the one returned, whichever way 'f' takes it
+    std::string init;
+    init.reserve(64);
+    const char* buffer = init.data();
+
+    std::string by_value = msg_parts.fold_left(
+        [](std::string msg, const std::string& part) {
+            msg += part;
+            return msg;
+        },
+        init);
+    EXPECT_EQ(by_value, "Hello, world");
+
+    std::string by_rvalue = msg_parts.reduce(
+        [](std::string&& msg, const std::string& part) -> std::string&& {
+            return std::move(msg += part);
+        },
+        std::move(init));
+    EXPECT_EQ(by_rvalue, "Hello, world");
+    EXPECT_EQ(by_rvalue.data(), buffer);
+
+    std::string in_place = msg_parts.fold_left(
+        [](std::string& msg, const std::string& part) { msg += part; },
+        std::move(by_rvalue));
+    EXPECT_EQ(in_place, "Hello, worldHello, world");
+    EXPECT_EQ(in_place.data(), buffer);
+
+    // Folding is from the left, even when 'f' is not associative
+    const cec::list<int> numbers = {1, 2, 3};
+    EXPECT_EQ(numbers.fold_left(std::minus<int>(), 10), 4);
+
+    // Elements of temporaries are moved in to 'f'
+    cec::vector<std::unique_ptr<int>> pointers;
+    pointers.emplace_back(new int(1));
+    pointers.emplace_back(new int(2));
+    auto collected = std::move(pointers).fold_left(
+        [](std::vector<std::unique_ptr<int>>& all, std::unique_ptr<int>&& p) {
+            all.push_back(std::move(p));
+        },
+        std::vector<std::unique_ptr<int>>());
+    EXPECT_EQ(*collected[1], 2);
+}
+
+TEST(SequenceContainer, reverse) {
+    cec::vector<int> numbers = {1, 2, 3};
+    EXPECT_EQ(numbers.reverse(), (cec::vector<int>{3, 2, 1}));
+
+    cec::list<std::string> words = {"a", "b"};
+    const std::string* a = &words.front();
+    words.reverse();
+    EXPECT_EQ(words, (cec::list<std::string>{"b", "a"}));
+    EXPECT_EQ(&words.back(), a);
+
+    cec::forward_list<int> singly = {1, 2, 3};
+    EXPECT_EQ(singly.reverse(), (cec::forward_list<int>{3, 2, 1}));
+}
+
+TEST(SequenceContainer, size_hint) {
+    // Producing operations should allocate their output exactly once
+    const cec::vector<int> numbers(1000, 1);
+    EXPECT_EQ(numbers.map([](int i) { return i * 2.0; }).capacity(), 1000u);
+    EXPECT_EQ(numbers.concat(numbers).capacity(), 2000u);
+    EXPECT_EQ(numbers.zip(cec::list<int>(10, 0)).capacity(), 10u);
+    EXPECT_EQ(numbers.zip_n(cec::list<int>(10, 0)).capacity(), 10u);
+
+    const cec::list<cec::vector<int>> nested(10, cec::vector<int>(100));
+    EXPECT_EQ(nested.flatten().capacity(), 1000u);
+
+    const cec::vector<std::pair<int, int>> pairs(50);
+    EXPECT_EQ(pairs.unzip().first.capacity(), 50u);
+}
+
 TEST(SequenceContainer, sort) {
     // Container with random access iterator
     cec::vector<int> numbers = {3, 2, 1, 15, 2, 15};
@@ -139,6 +769,118 @@ TEST(SequenceContainer, sort) {
     EXPECT_TRUE(std::is_sorted(letters.begin(), letters.end()));
 }
 
+TEST(SequenceContainer, parallel_sort) {
+    cec::vector<int> numbers(200000);
+    for (std::size_t i = 0; i < numbers.size(); ++i) {
+        numbers[i] = (i * 7919) % 100003;
+    }
+
+    auto sorted = numbers;
+    sorted.sort(cec::par);
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()));
+    EXPECT_EQ(sorted, cec::vector<int>(numbers).sort());
+
+    sorted.sort(cec::par, std::greater<int>{});
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end(),
+                               std::greater<int>{}));
+
+    // Sort pairs by their first element only, the second elements should
+    // remain in their original order
+    cec::vector<std::pair<int, int>> pairs(100000);
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+        pairs[i] = {static_cast<int>(i % 10), static_cast<int>(i)};
+    }
+    auto by_first = [](const std::pair<int, int>& a,
+                       const std::pair<int, int>& b) {
+        return a.first < b.first;
+    };
+    auto stable = pairs;
+    stable.stable_sort(cec::par, by_first);
+    auto serial = pairs;
+    serial.stable_sort(by_first);
+    EXPECT_EQ(stable, serial);
+    EXPECT_TRUE(std::is_sorted(stable.begin(), stable.end()));
+
+    cec::list<int> list = {3, 1, 2};
+    list.stable_sort(cec::par);
+    EXPECT_TRUE(std::is_sorted(list.begin(), list.end()));
+}
+
+TEST(SequenceContainer, radix_sort) {
+    cec::vector<std::int64_t> integers(5000);
+    cec::vector<double> doubles(5000);
+    for (std::size_t i = 0; i < integers.size(); ++i) {
+        integers[i] = static_cast<std::int64_t>((i * 7919) % 5003) - 2500;
+        doubles[i] = integers[i] * 0.5;
+    }
+    doubles[0] = -0.0;
+    doubles[1] = 1e300;
+    doubles[2] = -1e-300;
+
+    auto check = [](cec::vector<std::int64_t> v) {
+        auto compare = v;
+        std::sort(compare.begin(), compare.end());
+        EXPECT_EQ(v.sort(), compare);
+        std::reverse(compare.begin(), compare.end());
+        EXPECT_EQ(v.sort(std::greater<std::int64_t>{}), compare);
+    };
+    check(integers);
+
+    doubles.sort();
+    EXPECT_TRUE(std::is_sorted(doubles.begin(), doubles.end()));
+    doubles.sort(std::greater<double>{});
+    EXPECT_TRUE(std::is_sorted(doubles.begin(), doubles.end(),
+                               std::greater<double>{}));
+
+    cec::vector<unsigned char> bytes(3000);
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<unsigned char>(i * 31);
+    }
+    bytes.sort(cec::par);
+    EXPECT_TRUE(std::is_sorted(bytes.begin(), bytes.end()));
+
+    // sort_by should be stable
+    cec::vector<std::pair<float, std::string>> records(3000);
+    for (std::size_t i = 0; i < records.size(); ++i) {
+        records[i] = {static_cast<float>(i % 7) - 3.0f, std::to_string(i)};
+    }
+    auto compare = records;
+    std::stable_sort(compare.begin(), compare.end(),
+                     [](const std::pair<float, std::string>& a,
+                        const std::pair<float, std::string>& b) {
+                         return a.first < b.first;
+                     });
+    records.sort_by(
+        [](const std::pair<float, std::string>& r) { return r.first; });
+    EXPECT_EQ(records, compare);
+
+    // -0.0 and +0.0 are equivalent, so keep their order
+    auto first = [](const std::pair<double, char>& p) { return p.first; };
+    cec::vector<std::pair<double, char>> zeros = {{1.0, 'x'}, {0.0, 'a'},
+                                                  {-0.0, 'b'}};
+    zeros.sort_by(first);
+    EXPECT_EQ(zeros[0].second, 'a');
+    EXPECT_EQ(zeros[1].second, 'b');
+
+    for (auto size : {std::size_t(10), std::size_t(3000)}) {
+        cec::vector<double> signed_zeros(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            signed_zeros[i] = i % 3 == 0 ? -1.0 : i % 3 == 1 ? -0.0 : 0.0;
+        }
+        signed_zeros.stable_sort();
+        auto negatives = (size + 2) / 3;
+        for (std::size_t i = negatives; i < size; ++i) {
+            EXPECT_EQ(std::signbit(signed_zeros[i]), (i - negatives) % 2 == 0);
+        }
+    }
+
+    cec::list<std::pair<int, char>> list = {{2, 'a'}, {1, 'b'}, {2, 'c'}};
+    list.sort_by([](const std::pair<int, char>& p) { return p.first; });
+    const cec::list<std::pair<int, char>> list_compare = {
+        {1, 'b'}, {2, 'a'}, {2, 'c'}};
+    EXPECT_EQ(list, list_compare);
+}
+
 TEST(SequenceContainer, take) {
     const cec::vector<char> f = {'a', 'b', 'c', 'd'};
     auto taken = f.take(2);
@@ -148,6 +890,12 @@ TEST(SequenceContainer, take) {
     auto rvalue_test = f.map([](char c) { return 1; }).take(2);
     const cec::vector<int> check2 = {1, 1};
     EXPECT_EQ(rvalue_test, check2);
+
+    const cec::vector<cec::string> words = {"a", "b", "c"};
+    const cec::vector<cec::string> check3 = {"a", "b"};
+    EXPECT_EQ(words.take(2), check3);
+    EXPECT_EQ(words.take_while([](const cec::string& s) { return s < "c"; }),
+              check3);
 }
 
 TEST(SequenceContainer, take_while) {
@@ -170,6 +918,24 @@ TEST(SequenceContainer, transform) {
     EXPECT_EQ(container, compare);
 }
 
+TEST(SequenceContainer, unique) {
+    cec::vector<int> numbers = {1, 1, 2, 1, 3, 3};
+    EXPECT_EQ(numbers.unique(), (cec::vector<int>{1, 2, 1, 3}));
+
+    auto same_parity = [](int a, int b) { return a % 2 == b % 2; };
+    cec::deque<int> parities = {1, 3, 2, 4, 5};
+    EXPECT_EQ(parities.unique(same_parity), (cec::deque<int>{1, 2, 5}));
+
+    cec::list<std::string> words = {"a", "a", "b", "b"};
+    const std::string* b = &*std::next(words.begin(), 2);
+    words.unique();
+    EXPECT_EQ(words, (cec::list<std::string>{"a", "b"}));
+    EXPECT_EQ(&words.back(), b);
+
+    cec::forward_list<int> singly = {1, 1, 2};
+    EXPECT_EQ(singly.unique(), (cec::forward_list<int>{1, 2}));
+}
+
 TEST(SequenceContainer, unzip) {
     cec::vector<std::pair<char, std::string>> c = {{'a', "apple"},
                                                    {'b', "bear"},
@@ -181,6 +947,51 @@ TEST(SequenceContainer, unzip) {
     EXPECT_EQ(c.unzip(), unzipped);
 }
 
+TEST(SequenceContainer, view) {
+    const cec::vector<int> numbers = {1, 2, 3, 4, 5, 6, 7, 8};
+
+    // The chain should be evaluated lazily, and stop after the second match
+    int calls = 0;
+    cec::vector<int> evens = numbers.view()
+                                 .map([&calls](int i) {
+                                     ++calls;
+                                     return i * 10;
+                                 })
+                                 .filter([](int i) { return i % 20 == 0; })
+                                 .take(2)
+                                 .to<cec::vector<int>>();
+    const cec::vector<int> compare = {20, 40};
+    EXPECT_EQ(evens, compare);
+    EXPECT_EQ(calls, 4);
+
+    auto taken = numbers.view()
+                     .take_while([](int i) { return i < 4; })
+                     .to<cec::list<int>>();
+    const cec::list<int> compare2 = {1, 2, 3};
+    EXPECT_EQ(taken, compare2);
+
+    const cec::list<char> letters = {'a', 'b', 'c'};
+    auto zipped =
+        numbers.view().zip(letters).to<cec::vector<std::pair<int, char>>>();
+    const cec::vector<std::pair<int, char>> compare3 = {{1, 'a'},
+                                                        {2, 'b'},
+                                                        {3, 'c'}};
+    EXPECT_EQ(zipped, compare3);
+
+    // Temporary views may be zipped, as they do not own their elements
+    auto zipped_views = numbers.view()
+                            .zip(letters.view())
+                            .to<cec::vector<std::pair<int, char>>>();
+    EXPECT_EQ(zipped_views, compare3);
+
+    // Views over mutable containers refer to the original elements
+    cec::vector<int> mutable_numbers = numbers;
+    for (auto& i : mutable_numbers.view().filter([](int i) { return i > 6; })) {
+        i = 0;
+    }
+    EXPECT_EQ(mutable_numbers.count(0), 2);
+}
+
 TEST(SequenceContainer, zip) {
     cec::vector<int> c = {4, 3, 2, 1};
     cec::list<float> f = {1, 2, 3, 4};
@@ -198,3 +1009,64 @@ TEST(SequenceContainer, zip_n) {
          std::make_tuple(2, 3, 't'), std::make_tuple(1, 4, 's')};
     EXPECT_EQ(zipped3, compare);
 }
+
+TEST(SequenceContainer, zip_move) {
+    // Move only elements can be zipped and unzipped out of temporaries
+    cec::vector<std::unique_ptr<int>> keys;
+    keys.emplace_back(new int(1));
+    keys.emplace_back(new int(2));
+    cec::list<std::string> values = {"one", "two", "three"};
+
+    auto zipped = std::move(keys).zip(std::move(values));
+    ASSERT_EQ(zipped.size(), 2u);
+    EXPECT_EQ(*zipped[1].first, 2);
+    EXPECT_EQ(zipped[1].second, "two");
+    EXPECT_TRUE(values.front().empty());
+
+    auto unzipped = std::move(zipped).unzip();
+    EXPECT_EQ(*unzipped.first[0], 1);
+    EXPECT_EQ(unzipped.second, (cec::vector<std::string>{"one", "two"}));
+
+    // Only the rvalue inputs are moved from
+    cec::forward_list<std::unique_ptr<int>> ptrs;
+    ptrs.emplace_front(new int(3));
+    cec::deque<std::string> names = {"a", "b"};
+    auto tuples = unzipped.second.zip_n(std::move(ptrs), names);
+    ASSERT_EQ(tuples.size(), 1u);
+    EXPECT_EQ(*std::get<1>(tuples[0]), 3);
+    EXPECT_EQ(std::get<2>(tuples[0]), "a");
+    EXPECT_EQ(unzipped.second, (cec::vector<std::string>{"one", "two"}));
+    EXPECT_EQ(names, (cec::deque<std::string>{"a", "b"}));
+}
+
+TEST(SequenceContainer, zip_view) {
+    cec::vector<int> ids = {1, 2, 3};
+    cec::forward_list<std::string> names = {"a", "b"};
+
+    // Ends at the shorter input, and writes go back to the containers
+    int rows = 0;
+    for (auto row : ids.zip_view(names)) {
+        std::get<1>(row) += std::to_string(std::get<0>(row));
+        std::get<0>(row) *= 10;
+        ++rows;
+    }
+    EXPECT_EQ(rows, 2);
+    EXPECT_EQ(names, (cec::forward_list<std::string>{"a1", "b2"}));
+    EXPECT_EQ(ids, (cec::vector<int>{10, 20, 3}));
+
+    // Random access when every input is
+    const cec::deque<char> letters = {'x', 'y', 'z', 'w'};
+    cec::string s = "cats";
+    auto view = ids.zip_n_view(letters, s);
+    EXPECT_EQ(std::distance(view.begin(), view.end()), 3);
+    std::get<2>(view.begin()[2]) = 'p';
+    EXPECT_EQ(s, "caps");
+    auto last = view.end() - 1;
+    EXPECT_EQ(std::get<0>(*last), 3);
+    EXPECT_EQ(std::get<1>(*last), 'z');
+
+    auto copied =
+        ids.zip_n_view(letters).to<cec::vector<std::tuple<int, char>>>();
+    EXPECT_EQ(copied.size(), 3u);
+    EXPECT_EQ(copied[2], std::make_tuple(3, 'z'));
+}
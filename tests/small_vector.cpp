@@ -0,0 +1,154 @@
+#include <gtest/gtest.h>
+#include <cec/small_vector.hpp>
+#include <cec/string.hpp>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+TEST(small_vector, construction) {
+    cec::small_vector<int> empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.is_inline());
+    EXPECT_EQ(empty.capacity(), 8u);
+
+    cec::small_vector<int, 4> counted(3, 7);
+    EXPECT_EQ(counted, (cec::small_vector<int, 4>{7, 7, 7}));
+
+    std::string chars = "abc";
+    cec::small_vector<char, 2> ranged(chars.begin(), chars.end());
+    EXPECT_EQ(ranged.size(), 3u);
+    EXPECT_FALSE(ranged.is_inline());
+    EXPECT_EQ(ranged[2], 'c');
+}
+
+TEST(small_vector, growth) {
+    cec::small_vector<std::string, 2> strings;
+    strings.push_back("one");
+    strings.emplace_back("two");
+    EXPECT_TRUE(strings.is_inline());
+
+    // Spills to the heap beyond the inline capacity
+    strings.emplace_back(strings.front());
+    EXPECT_FALSE(strings.is_inline());
+    EXPECT_EQ(strings,
+              (cec::small_vector<std::string, 2>{"one", "two", "one"}));
+
+    strings.insert(strings.begin() + 1, 2, "x");
+    EXPECT_EQ(strings, (cec::small_vector<std::string, 2>{"one", "x", "x",
+                                                          "two", "one"}));
+    strings.erase(strings.begin(), strings.begin() + 3);
+    EXPECT_EQ(strings, (cec::small_vector<std::string, 2>{"two", "one"}));
+
+    // and returns to inline storage when shrunk
+    strings.shrink_to_fit();
+    EXPECT_TRUE(strings.is_inline());
+    EXPECT_EQ(strings, (cec::small_vector<std::string, 2>{"two", "one"}));
+
+    strings.resize(4, "z");
+    EXPECT_EQ(strings.back(), "z");
+    strings.resize(1);
+    EXPECT_EQ(strings.size(), 1u);
+    EXPECT_THROW(strings.at(1), std::out_of_range);
+}
+
+TEST(small_vector, copy_and_move) {
+    cec::small_vector<std::unique_ptr<int>, 2> inline_ptrs;
+    inline_ptrs.emplace_back(new int(1));
+    auto moved_inline = std::move(inline_ptrs);
+    EXPECT_EQ(*moved_inline[0], 1);
+    EXPECT_TRUE(inline_ptrs.empty());
+
+    cec::small_vector<int, 2> heap = {1, 2, 3, 4};
+    const int* storage = heap.data();
+    auto moved = std::move(heap);
+    EXPECT_EQ(moved.data(), storage);
+    EXPECT_TRUE(heap.empty());
+
+    auto copied = moved;
+    EXPECT_EQ(copied, moved);
+    EXPECT_NE(copied.data(), moved.data());
+
+    cec::small_vector<int, 2> small = {9};
+    swap(small, copied);
+    EXPECT_EQ(small.size(), 4u);
+    EXPECT_EQ(copied, (cec::small_vector<int, 2>{9}));
+}
+
+// Counts live instances, and throws from the copy which brings the number
+// of copies made to 'copies_allowed'
+struct throwing_copy {
+    static int live;
+    static int copies_allowed;
+
+    throwing_copy() { ++live; }
+    throwing_copy(const throwing_copy&) {
+        if (--copies_allowed == 0) {
+            throw std::runtime_error("copy");
+        }
+        ++live;
+    }
+    ~throwing_copy() { --live; }
+};
+
+int throwing_copy::live = 0;
+int throwing_copy::copies_allowed = 0;
+
+TEST(small_vector, exception_safety) {
+    static_assert(
+        std::is_nothrow_move_constructible<cec::small_vector<int, 2>>::value,
+        "moving a small_vector of nothrow movable elements cannot throw");
+    static_assert(
+        std::is_nothrow_move_assignable<cec::small_vector<int, 2>>::value,
+        "moving a small_vector of nothrow movable elements cannot throw");
+
+    {
+        cec::small_vector<throwing_copy, 2> items(3);
+        EXPECT_EQ(throwing_copy::live, 3);
+
+        // Growing copies the elements, as moving them may throw. The
+        // copies made before one throws are destroyed.
+        throwing_copy::copies_allowed = 3;
+        EXPECT_THROW(items.reserve(10), std::runtime_error);
+        EXPECT_EQ(throwing_copy::live, 3);
+        EXPECT_EQ(items.size(), 3u);
+
+        throwing_copy::copies_allowed = 3;
+        EXPECT_THROW(items.emplace_back(), std::runtime_error);
+        EXPECT_EQ(throwing_copy::live, 3);
+        EXPECT_EQ(items.size(), 3u);
+
+        throwing_copy::copies_allowed = 0;
+        items.reserve(10);
+        EXPECT_EQ(throwing_copy::live, 3);
+    }
+    EXPECT_EQ(throwing_copy::live, 0);
+}
+
+TEST(small_vector, rebind) {
+    const cec::small_vector<int, 4> numbers = {1, 2, 3};
+
+    // map() and friends produce small vectors with the same capacity
+    auto halves = numbers.map([](int i) { return i * 0.5; });
+    EXPECT_TRUE((std::is_same<decltype(halves),
+                              cec::small_vector<double, 4>>::value));
+    EXPECT_TRUE(halves.is_inline());
+    EXPECT_EQ(halves, (cec::small_vector<double, 4>{0.5, 1.0, 1.5}));
+
+    auto pairs = numbers.zip(halves);
+    EXPECT_TRUE(
+        (std::is_same<decltype(pairs),
+                      cec::small_vector<std::pair<int, double>, 4>>::value));
+    EXPECT_EQ(pairs.unzip().first, numbers);
+
+    EXPECT_EQ(numbers.filter([](int i) { return i != 2; }),
+              (cec::small_vector<int, 4>{1, 3}));
+    EXPECT_EQ(numbers.reduce([](int a, int b) { return a + b; }), 6);
+
+    cec::small_vector<int, 4> unsorted = {3, 1, 2};
+    EXPECT_EQ(unsorted.sort(), numbers);
+
+    auto tokens = cec::string("a b c").split<cec::small_vector<cec::string>>();
+    EXPECT_EQ(tokens.size(), 3u);
+    EXPECT_TRUE(tokens.is_inline());
+}
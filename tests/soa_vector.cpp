@@ -0,0 +1,120 @@
+#include <gtest/gtest.h>
+#include <cec/soa_vector.hpp>
+#include <cec/list.hpp>
+#include <cec/vector.hpp>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+
+TEST(soa_vector, construction) {
+    cec::soa_vector<int, std::string> rows = {std::make_tuple(1, "one"),
+                                              std::make_tuple(2, "two")};
+    EXPECT_EQ(rows.size(), 2u);
+    EXPECT_EQ(rows.column<0>(), (cec::vector<int>{1, 2}));
+    EXPECT_EQ(rows.column<1>(), (cec::vector<std::string>{"one", "two"}));
+    EXPECT_TRUE(rows[1] == std::make_tuple(2, std::string("two")));
+    EXPECT_THROW(rows.at(2), std::out_of_range);
+
+    cec::soa_vector<int, std::string> columns(cec::vector<int>{1, 2},
+                                              cec::vector<std::string>{
+                                                  "one", "two"});
+    EXPECT_EQ(rows, columns);
+    EXPECT_THROW((cec::soa_vector<int, int>(cec::vector<int>{1},
+                                            cec::vector<int>{1, 2})),
+                 std::invalid_argument);
+
+    auto moved = std::move(columns).columns();
+    EXPECT_EQ(std::get<1>(moved), (cec::vector<std::string>{"one", "two"}));
+}
+
+TEST(soa_vector, modifiers) {
+    cec::soa_vector<int, char> rows;
+    rows.emplace_back(1, 'a');
+    rows.push_back(std::make_tuple(3, 'c'));
+    rows.emplace(rows.begin() + 1, std::make_pair(2, 'b'));
+    EXPECT_EQ(rows.column<0>(), (cec::vector<int>{1, 2, 3}));
+    EXPECT_EQ(rows.column<1>(), (cec::vector<char>{'a', 'b', 'c'}));
+
+    rows.insert(rows.begin(), {std::make_tuple(0, 'z'), std::make_tuple(0, 'y')});
+    EXPECT_EQ(rows.column<1>(), (cec::vector<char>{'z', 'y', 'a', 'b', 'c'}));
+
+    rows.erase(rows.begin(), rows.begin() + 2);
+    rows.pop_back();
+    EXPECT_EQ(rows, (cec::soa_vector<int, char>{std::make_tuple(1, 'a'),
+                                                std::make_tuple(2, 'b')}));
+
+    // Rows are assigned and swapped through their references
+    rows[0] = std::make_tuple(5, 'e');
+    swap(rows[0], rows[1]);
+    EXPECT_EQ(rows, (cec::soa_vector<int, char>{std::make_tuple(2, 'b'),
+                                                std::make_tuple(5, 'e')}));
+
+    rows.resize(3);
+    EXPECT_TRUE(rows.back() == std::make_tuple(0, '\0'));
+    rows.clear();
+    EXPECT_TRUE(rows.empty());
+}
+
+TEST(soa_vector, operations) {
+    cec::soa_vector<int, std::string> rows = {std::make_tuple(3, "c"),
+                                              std::make_tuple(1, "a"),
+                                              std::make_tuple(2, "b")};
+    using row = std::tuple<int, std::string>;
+
+    rows.sort();
+    EXPECT_EQ(rows.column<0>(), (cec::vector<int>{1, 2, 3}));
+    EXPECT_EQ(rows.column<1>(), (cec::vector<std::string>{"a", "b", "c"}));
+
+    EXPECT_TRUE(rows.contains(row(2, "b")));
+    EXPECT_EQ(rows.count_if([](const row& r) { return std::get<0>(r) > 1; }),
+              2);
+
+    // Producing tuples gives another soa_vector, anything else a vector
+    cec::soa_vector<std::string, int> swapped = rows.map([](const row& r) {
+        return std::make_tuple(std::get<1>(r), std::get<0>(r));
+    });
+    EXPECT_EQ(swapped.column<1>(), (cec::vector<int>{1, 2, 3}));
+    cec::vector<int> doubled =
+        rows.map([](const row& r) { return std::get<0>(r) * 2; });
+    EXPECT_EQ(doubled, (cec::vector<int>{2, 4, 6}));
+
+    auto odd = rows.filter([](const row& r) { return std::get<0>(r) % 2; });
+    EXPECT_EQ(odd.column<1>(), (cec::vector<std::string>{"a", "c"}));
+
+    auto copy = rows;
+    copy.erase_if([](const row& r) { return std::get<1>(r) == "b"; });
+    EXPECT_EQ(copy, odd);
+    EXPECT_EQ(rows.take(1).column<0>(), (cec::vector<int>{1}));
+}
+
+TEST(soa_vector, columns) {
+    cec::soa_vector<int, double> rows = {std::make_tuple(1, 0.5),
+                                         std::make_tuple(2, 1.5),
+                                         std::make_tuple(3, 2.5)};
+
+    EXPECT_EQ(rows.map_column<1>([](double d) { return d * 2; }),
+              (cec::vector<double>{1.0, 3.0, 5.0}));
+    EXPECT_EQ(rows.column<0>().reduce(std::plus<int>(), 0), 6);
+
+    auto large = rows.filter_column<1>([](double d) { return d > 1.0; });
+    EXPECT_EQ(large, (cec::soa_vector<int, double>{std::make_tuple(2, 1.5),
+                                                   std::make_tuple(3, 2.5)}));
+}
+
+TEST(soa_vector, unzip_and_zip) {
+    cec::list<std::pair<int, char>> pairs = {{1, 'a'}, {2, 'b'}};
+    cec::soa_vector<int, char> unzipped = pairs.unzip_soa();
+    EXPECT_EQ(unzipped.column<0>(), (cec::vector<int>{1, 2}));
+    EXPECT_EQ(unzipped.column<1>(), (cec::vector<char>{'a', 'b'}));
+
+    cec::vector<int> ids = {1, 2, 3};
+    cec::list<char> letters = {'a', 'b'};
+    cec::soa_vector<int, char> zipped = ids.zip_soa(letters);
+    EXPECT_EQ(zipped, unzipped);
+
+    cec::vector<double> weights = {0.5, 1.5};
+    auto three = ids.zip_soa(letters, weights);
+    EXPECT_TRUE(three[1] == std::make_tuple(2, 'b', 1.5));
+}
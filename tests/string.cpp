@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 #include <cec/string.hpp>
+#include <cec/string_builder.hpp>
 #include <cec/forward_list.hpp>
+#include <cstdint>
+#include <vector>
 
 TEST(string, constructor) {
     cec::string str1;
@@ -29,7 +32,34 @@ TEST(string, split) {
     split = msg.split();
     compare = {msg};
     EXPECT_EQ(split, compare);
+
+    msg = "in original order";
+    auto singly = msg.split<cec::forward_list<cec::string>>();
+    EXPECT_EQ(singly,
+              (cec::forward_list<cec::string>{"in", "original", "order"}));
+}
+
+#ifdef CEC_HAS_STRING_VIEW
+TEST(string, split_view) {
+    const cec::string line = "a,bc,,d";
+    cec::vector<std::string_view> fields = line.split_view(',');
+    cec::vector<std::string_view> compare = {"a", "bc", "", "d"};
+    EXPECT_EQ(fields, compare);
+
+    // The fields should refer to the original string
+    EXPECT_EQ(fields[1].data(), line.data() + 2);
+
+    const cec::string msg = "one::two::three::";
+    compare = {"one", "two", "three", ""};
+    EXPECT_EQ(msg.split_view("::"), compare);
+
+    compare = {"word"};
+    const cec::string word = "word";
+    EXPECT_EQ(word.split_view(' '), compare);
+
+    EXPECT_THROW(word.split_view(""), std::invalid_argument);
 }
+#endif
 
 TEST(string, join) {
     cec::forward_list<cec::string> parts = {"hello", "world"};
@@ -39,14 +69,166 @@ TEST(string, join) {
     parts = {"word"};
     joined = cec::string(", ").join(parts);
     EXPECT_EQ(joined, "word");
+
+    parts.clear();
+    EXPECT_TRUE(cec::string(", ").join(parts).empty());
+
+    // Parts are sized, so the result is allocated once
+    cec::vector<cec::string> sized = {"a", "bc", "", "def"};
+    joined = cec::string("--").join(sized);
+    EXPECT_EQ(joined, "a--bc----def");
+
+    // Parts without a size() are appended as they are
+    cec::vector<const char*> literals = {"x", "y", "z"};
+    EXPECT_EQ(cec::string("/").join(literals), "x/y/z");
+}
+
+TEST(string, string_builder) {
+    cec::string_builder builder;
+    EXPECT_TRUE(builder.empty());
+    EXPECT_TRUE(builder.str().empty());
+
+    cec::string part = "part";
+    builder << "a " << part << ' ' << std::string("b");
+    EXPECT_EQ(builder.size(), 8u);
+    EXPECT_EQ(builder.str(), "a part b");
+
+    // Appends which span several blocks are materialized in order
+    cec::string expected;
+    builder.clear();
+    for (int i = 0; i < 10000; ++i) {
+        cec::string piece(i % 7 + 1, static_cast<char>('a' + i % 26));
+        builder << piece;
+        expected += piece;
+    }
+    cec::string large(100000, 'z');
+    builder.append(large.data(), large.size());
+    expected += large;
+    EXPECT_EQ(builder.size(), expected.size());
+    EXPECT_EQ(builder.str(), expected);
+
+    cec::wstring_builder wide;
+    wide << L"wide" << L' ' << std::wstring(L"string");
+    EXPECT_EQ(wide.str(), L"wide string");
+
+    // Numbers are formatted, rather than converted to characters
+    cec::string_builder numbers;
+    numbers << "n=" << 42 << ' ' << -7L << ' ' << 2.5 << ' ' << 3u;
+    EXPECT_EQ(numbers.str(), "n=42 -7 2.500000 3");
+
+    wide.clear();
+    wide << L"n=" << 42 << 'x';
+    EXPECT_EQ(wide.str(), L"n=42x");
 }
 
 TEST(string, to_lower) {
     cec::string msg = "A mixed Case MeSSaGe.";
     EXPECT_EQ(msg.to_lower(), "a mixed case message.");
+
+    // Long enough to be converted in vector sized blocks, non-ASCII
+    // characters are left alone
+    cec::string long_msg = "@AZ[`az{ \xC3\x89T\xC3\xA9 UPPER lower 0123 !?~ \xFF";
+    EXPECT_EQ(long_msg.to_lower(),
+              "@az[`az{ \xC3\x89t\xC3\xA9 upper lower 0123 !?~ \xFF");
+    EXPECT_EQ(cec::string(long_msg).to_lower(), long_msg.to_lower());
+
+    cec::wstring wide = L"Wide STRING";
+    EXPECT_EQ(wide.to_lower(), L"wide string");
+
+    cec::u32string u32 = U"U32 \u00C9 String";
+    EXPECT_EQ(u32.to_lower(), U"u32 \u00C9 string");
 }
 
 TEST(string, to_upper) {
     cec::string msg = "A mixed Case MeSSaGe.";
     EXPECT_EQ(msg.to_upper(), "A MIXED CASE MESSAGE.");
+
+    cec::string long_msg(100, 'q');
+    EXPECT_EQ(std::move(long_msg).to_upper(), cec::string(100, 'Q'));
+
+    cec::u16string u16 = u"u16 string";
+    EXPECT_EQ(u16.to_upper(), u"U16 STRING");
+}
+
+// Converts every character of 'values' (long enough to be converted in
+// vector sized blocks) to each case, checking that only ASCII letters are
+// changed
+template <typename String>
+void check_case_conversion(const std::vector<std::uint32_t>& values) {
+    using char_type = typename String::value_type;
+    String text;
+    for (auto value : values) {
+        text.push_back(static_cast<char_type>(value));
+    }
+
+    String lower = text.to_lower();
+    String upper = text.to_upper();
+    ASSERT_EQ(lower.size(), text.size());
+    ASSERT_EQ(upper.size(), text.size());
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        char_type c = text[i];
+        bool is_upper = c >= char_type('A') && c <= char_type('Z');
+        bool is_lower = c >= char_type('a') && c <= char_type('z');
+        EXPECT_EQ(lower[i], is_upper ? char_type(c + 32) : c);
+        EXPECT_EQ(upper[i], is_lower ? char_type(c - 32) : c);
+    }
+}
+
+TEST(string, case_conversion_wide) {
+    // Every code unit up to 0x17F, and characters which only differ from
+    // ASCII letters in their upper bits
+    std::vector<std::uint32_t> values;
+    for (std::uint32_t c = 0; c < 0x180; ++c) {
+        values.push_back(c);
+    }
+    for (std::uint32_t high : {0x0100u, 0x7F00u, 0x8000u, 0xFF00u}) {
+        values.push_back(high | 'A');
+        values.push_back(high | 'z');
+    }
+
+    check_case_conversion<cec::wstring>(values);
+    check_case_conversion<cec::u16string>(values);
+
+    for (std::uint32_t high : {0x10000u, 0x7FFF0000u, 0x80000000u}) {
+        values.push_back(high | 'A');
+        values.push_back(high | 'z');
+    }
+    check_case_conversion<cec::u32string>(values);
+}
+
+TEST(string, contains) {
+    cec::string msg = "hello world";
+    EXPECT_TRUE(msg.contains('w'));
+    EXPECT_FALSE(msg.contains('z'));
+    EXPECT_TRUE(msg.contains("o w"));
+    EXPECT_TRUE(msg.contains(std::string("world")));
+    EXPECT_TRUE(msg.contains(cec::string("hello")));
+    EXPECT_TRUE(msg.contains(""));
+    EXPECT_FALSE(msg.contains("worlds"));
+    EXPECT_FALSE(msg.contains("olleh"));
+    EXPECT_EQ(msg.count('o'), 2);
+
+    // Needles are found at every position of a long string, including those
+    // where only their first and last characters match
+    cec::string text(100, 'a');
+    for (std::size_t i = 0; i + 3 <= text.size(); ++i) {
+        cec::string haystack = text;
+        haystack.replace(i, 3, "bab");
+        EXPECT_TRUE(haystack.contains("bab"));
+        EXPECT_TRUE(haystack.contains("ba"));
+        EXPECT_FALSE(haystack.contains("bbb"));
+        EXPECT_FALSE(haystack.contains("bcb"));
+    }
+
+    cec::wstring wide = L"wide string";
+    EXPECT_TRUE(wide.contains(L"de st"));
+    EXPECT_FALSE(wide.contains(L"narrow"));
+}
+
+TEST(string, hash) {
+    EXPECT_EQ(std::hash<cec::string>()("hello"),
+              std::hash<std::string>()("hello"));
+
+    cec::vector<cec::string> words = {"b", "a", "b", "a"};
+    EXPECT_EQ(words.distinct(), (cec::vector<cec::string>{"b", "a"}));
 }